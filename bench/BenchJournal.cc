@@ -0,0 +1,341 @@
+#include "BenchJournal.h"
+#include "fmt/format.h"
+#include "pland/land/LandJournal.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+
+namespace bench {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+using land::LandJournal;
+using Type = LandJournal::RecordType;
+
+constexpr auto NoGroupCommit = std::chrono::milliseconds{60000}; // 只在 flush/checkpoint/析构时提交，便于检查合并
+
+struct Expected {
+    Type         type;
+    land::LandID landId;
+    std::string  payload;
+};
+
+class Checker {
+public:
+    explicit Checker(fs::path dir) : mDir(std::move(dir)) {}
+
+    void run(std::string_view name, std::function<bool(fs::path const&, std::string&)> const& fn) {
+        auto file = mDir / fmt::format("{}.journal", name);
+
+        std::error_code ec;
+        fs::remove(file, ec);
+
+        std::string error;
+        bool        ok = false;
+        try {
+            ok = fn(file, error);
+        } catch (std::exception const& e) {
+            error = e.what();
+        }
+        fmt::print("{:<24} {}{}\n", name, ok ? "ok" : "FAIL", ok ? "" : fmt::format(": {}", error));
+        mFailed += !ok;
+    }
+
+    [[nodiscard]] int failed() const { return mFailed; }
+
+private:
+    fs::path mDir;
+    int      mFailed{0};
+};
+
+bool expectRecords(LandJournal::ReadResult const& result, std::vector<Expected> const& expected, std::string& error) {
+    if (result.records.size() != expected.size()) {
+        error = fmt::format("expected {} record(s), got {}", expected.size(), result.records.size());
+        return false;
+    }
+    uint64_t lastSeq = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        auto const& got  = result.records[i];
+        auto const& want = expected[i];
+        if (got.type != want.type || got.landId != want.landId || got.payload != want.payload) {
+            error = fmt::format(
+                "record {}: got (type {}, land {}, {} byte(s)), want (type {}, land {}, {} byte(s))",
+                i,
+                static_cast<int>(got.type),
+                got.landId,
+                got.payload.size(),
+                static_cast<int>(want.type),
+                want.landId,
+                want.payload.size()
+            );
+            return false;
+        }
+        if (got.seq <= lastSeq) {
+            error = fmt::format("record {}: seq {} is not increasing", i, got.seq);
+            return false;
+        }
+        lastSeq = got.seq;
+    }
+    return true;
+}
+
+std::string readFile(fs::path const& file) {
+    std::ifstream ifs(file, std::ios::binary);
+    return {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+}
+
+void writeFile(fs::path const& file, std::string const& data) {
+    std::ofstream ofs(file, std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+// 写入三条记录，返回第二条记录在文件中的起始位置
+size_t writeThreeRecords(fs::path const& file) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.upsert(1, R"({"mLandID":1})");
+        journal.update(2, Type::SetName, "second");
+        journal.update(3, Type::AddMember, "member");
+    }
+    return LandJournal::HeaderSize + std::string_view{R"({"mLandID":1})"}.size();
+}
+
+bool roundTrip(fs::path const& file, std::string& error) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.upsert(1, R"({"mLandID":1})");
+        journal.update(1, Type::SetOwner, "owner");
+        journal.update(2, Type::SetRange, LandJournal::encodeInts({-1, 0, 2, 15, 255, 31}));
+        journal.remove(3);
+        journal.update(4, Type::SetDescribe, std::string(70000, 'x')); // 大于 u16 的 payload
+    }
+    auto result = LandJournal::read(file);
+    if (result.tornTail) {
+        error = "unexpected torn tail";
+        return false;
+    }
+    return expectRecords(
+        result,
+        {
+            {Type::Upsert,      1, R"({"mLandID":1})"                             },
+            {Type::SetOwner,    1, "owner"                                        },
+            {Type::SetRange,    2, LandJournal::encodeInts({-1, 0, 2, 15, 255, 31})},
+            {Type::Remove,      3, ""                                             },
+            {Type::SetDescribe, 4, std::string(70000, 'x')                        },
+    },
+        error
+    );
+}
+
+bool reopenAppends(fs::path const& file, std::string& error) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.update(1, Type::SetName, "a");
+    }
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.update(1, Type::SetName, "b");
+    }
+    auto result = LandJournal::read(file);
+    // 重新打开后序号从 1 开始，按文件顺序重放
+    if (result.records.size() != 2 || result.records[0].payload != "a" || result.records[1].payload != "b") {
+        error = fmt::format("expected [a, b], got {} record(s)", result.records.size());
+        return false;
+    }
+    return true;
+}
+
+bool coalesce(fs::path const& file, std::string& error) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.update(1, Type::SetName, "a");
+        journal.update(1, Type::AddMember, "m1");
+        journal.update(1, Type::SetName, "b"); // 覆盖 a
+        journal.update(1, Type::AddMember, "m2");
+        journal.update(1, Type::RemoveMember, "m1"); // 成员增删保持原样
+
+        journal.update(2, Type::SetName, "x");
+        journal.update(2, Type::SetOriginalBuyPrice, LandJournal::encodeInts({100}));
+        journal.upsert(2, "full"); // 覆盖领地 2 之前的全部记录
+        journal.update(2, Type::SetName, "y");
+
+        journal.update(3, Type::SetOwner, "o");
+        journal.remove(3);
+    }
+    return expectRecords(
+        LandJournal::read(file),
+        {
+            {Type::AddMember,    1, "m1"  },
+            {Type::SetName,      1, "b"   },
+            {Type::AddMember,    1, "m2"  },
+            {Type::RemoveMember, 1, "m1"  },
+            {Type::Upsert,       2, "full"},
+            {Type::SetName,      2, "y"   },
+            {Type::Remove,       3, ""    },
+    },
+        error
+    );
+}
+
+bool tornTail(fs::path const& file, std::string& error) {
+    writeThreeRecords(file);
+    auto data = readFile(file);
+
+    for (size_t cut : {size_t{1}, size_t{7}, LandJournal::HeaderSize + 1}) {
+        writeFile(file, data.substr(0, data.size() - cut));
+        auto result = LandJournal::read(file);
+        if (!result.tornTail) {
+            error = fmt::format("cut {} byte(s): torn tail not reported", cut);
+            return false;
+        }
+        if (!expectRecords(
+                result,
+                {
+                    {Type::Upsert,  1, R"({"mLandID":1})"},
+                    {Type::SetName, 2, "second"         },
+        },
+                error
+            )) {
+            error = fmt::format("cut {} byte(s): {}", cut, error);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool crcMismatch(fs::path const& file, std::string& error) {
+    auto second = writeThreeRecords(file);
+    auto data   = readFile(file);
+
+    data[second + LandJournal::HeaderSize] ^= 0x20; // 第二条记录的 payload 首字节
+    writeFile(file, data);
+
+    auto result = LandJournal::read(file);
+    if (!result.tornTail) {
+        error = "corrupted record not reported";
+        return false;
+    }
+    // 损坏的记录及其之后的记录都被丢弃
+    return expectRecords(result, {{Type::Upsert, 1, R"({"mLandID":1})"}}, error);
+}
+
+bool checkpointKeepsTail(fs::path const& file, std::string& error) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.update(1, Type::SetName, "saved");
+        journal.update(2, Type::SetName, "saved");
+        journal.flush();
+
+        auto seq = journal.getLastSeq(); // 模拟保存: 此前的记录已落库
+
+        journal.update(3, Type::SetName, "committed"); // 保存期间提交
+        journal.flush();
+        journal.update(4, Type::SetName, "pending"); // 检查点时仍在队列中
+        journal.checkpoint(seq);
+
+        auto result = LandJournal::read(file);
+        if (!expectRecords(
+                result,
+                {
+                    {Type::SetName, 3, "committed"},
+                    {Type::SetName, 4, "pending"  },
+        },
+                error
+            )) {
+            error = "after checkpoint: " + error;
+            return false;
+        }
+
+        // 检查点之后继续追加
+        journal.update(5, Type::SetName, "after");
+        journal.checkpoint(journal.getLastSeq() - 1);
+    }
+    return expectRecords(LandJournal::read(file), {{Type::SetName, 5, "after"}}, error);
+}
+
+bool checkpointAll(fs::path const& file, std::string& error) {
+    {
+        LandJournal journal{file, NoGroupCommit, false};
+        journal.upsert(1, "a");
+        journal.upsert(2, "b");
+        journal.checkpoint(journal.getLastSeq());
+    }
+    std::error_code ec;
+    if (auto size = fs::file_size(file, ec); ec || size != 0) {
+        error = fmt::format("expected an empty journal, size {}", ec ? 0 : size);
+        return false;
+    }
+    return true;
+}
+
+bool intPayload(fs::path const&, std::string& error) {
+    auto payload = LandJournal::encodeInts({-30000000, 0, 30000000});
+
+    std::array<int32_t, 3> values{};
+    if (!LandJournal::decodeInts(payload, values) || values != std::array<int32_t, 3>{-30000000, 0, 30000000}) {
+        error = "round trip mismatch";
+        return false;
+    }
+    std::array<int32_t, 2> wrongSize{};
+    if (LandJournal::decodeInts(payload, wrongSize)) {
+        error = "size mismatch accepted";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+
+int runJournalCommand(int argc, char** argv) {
+    std::random_device rd;
+    fs::path           dir = fs::temp_directory_path() / fmt::format("pland-journal-{:08x}", rd());
+    for (int i = 0; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--dir" && i + 1 < argc) {
+            dir = argv[++i];
+        } else {
+            fmt::print(
+                arg == "--help" || arg == "-h" ? stdout : stderr,
+                "usage:\n"
+                "  journal [--dir <dir>]   run the land journal self-checks in <dir> (default: a temp directory)\n"
+            );
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    Checker checker{dir};
+    checker.run("roundTrip", roundTrip);
+    checker.run("reopenAppends", reopenAppends);
+    checker.run("coalesce", coalesce);
+    checker.run("tornTail", tornTail);
+    checker.run("crcMismatch", crcMismatch);
+    checker.run("checkpointKeepsTail", checkpointKeepsTail);
+    checker.run("checkpointAll", checkpointAll);
+    checker.run("intPayload", intPayload);
+
+    fs::remove_all(dir, ec);
+    if (checker.failed()) {
+        fmt::print("{} check(s) failed\n", checker.failed());
+        return 1;
+    }
+    return 0;
+}
+
+
+} // namespace bench
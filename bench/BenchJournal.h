@@ -0,0 +1,15 @@
+#pragma once
+
+
+namespace bench {
+
+
+/**
+ * @brief journal 子命令入口: 领地预写日志(LandJournal)的自检
+ *   journal [--dir <临时目录>]
+ * 覆盖记录往返、合并规则、末尾不完整、CRC 校验失败与检查点保留未落库的记录，任一检查失败时返回 1
+ */
+int runJournalCommand(int argc, char** argv);
+
+
+} // namespace bench
@@ -0,0 +1,278 @@
+#include "BenchJournal.h"
+#include "BenchRegistry.h"
+#include "BenchReport.h"
+#include "BenchStats.h"
+#include "BenchTrace.h"
+#include "BenchWorld.h"
+#include "fmt/format.h"
+#include "pland/aabb/LandAABBTree.h"
+#include "pland/land/LandDimensionChunkMap.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// 用法:
+//   PLandBench [--lands N] [--ops N] [--seed S] [--scenario uniform|towns|nested|huge|all]
+//              [--csv <输出文件>] [--baseline <基线文件>] [--help]
+//   PLandBench trace gen|replay ...   (见 BenchTrace.h)
+//   PLandBench journal [--dir <目录>]   (领地预写日志自检，见 BenchJournal.h)
+//
+// 每个场景依次测量 insert / point / radius / box / refresh / remove，另有与场景无关的 aabb 组。
+// --csv 写出结果，--baseline 读取之前写出的结果并打印吞吐量变化。
+
+namespace bench {
+namespace {
+
+struct Options {
+    size_t                 lands{10000};
+    size_t                 ops{100000};
+    uint32_t               seed{42};
+    std::vector<WorldKind> scenarios{WorldKind::Uniform, WorldKind::Towns, WorldKind::Nested, WorldKind::Huge};
+    std::string            csv;
+    std::string            baseline;
+    bool                   help{false};
+};
+
+size_t volatile Sink = 0; // 防止查询结果被优化掉
+
+void runScenario(WorldKind kind, Options const& opt, std::vector<Row>& rows) {
+    auto name  = toString(kind);
+    auto world = generateWorld(WorldSpec{kind, opt.lands, opt.seed});
+
+    std::mt19937  rng{opt.seed ^ 0x9E3779B9u};
+    BenchRegistry registry;
+
+    // insert
+    {
+        BenchStats stats;
+        stats.run(world.lands.size(), [&](size_t i) {
+            registry.addLand(std::make_shared<BenchLand>(world.lands[i]));
+        });
+        rows.push_back(makeRow(name, "insert", stats));
+    }
+
+    // point
+    {
+        std::vector<BlockPos> positions(opt.ops);
+        for (auto& pos : positions) pos = randomQueryPos(world, rng);
+
+        BenchStats stats;
+        stats.run(positions.size(), [&](size_t i) { Sink = Sink + (registry.getLandAt(positions[i], 0) != nullptr); });
+        rows.push_back(makeRow(name, "point", stats));
+    }
+
+    // radius
+    {
+        std::vector<std::pair<BlockPos, int>> queries(opt.ops / 4);
+        std::uniform_int_distribution<int>    radius{8, 64};
+        for (auto& [pos, r] : queries) {
+            pos = randomQueryPos(world, rng);
+            r   = radius(rng);
+        }
+
+        BenchStats stats;
+        stats.run(queries.size(), [&](size_t i) {
+            Sink = Sink + registry.getLandAt(queries[i].first, queries[i].second, 0).size();
+        });
+        rows.push_back(makeRow(name, "radius", stats));
+    }
+
+    // box
+    {
+        std::vector<std::pair<BlockPos, BlockPos>> queries(opt.ops / 4);
+        std::uniform_int_distribution<int>         size{32, 256};
+        for (auto& [pos1, pos2] : queries) {
+            pos1 = randomQueryPos(world, rng);
+            pos2 = BlockPos{pos1.x + size(rng), pos1.y + size(rng) / 4, pos1.z + size(rng)};
+        }
+
+        BenchStats stats;
+        stats.run(queries.size(), [&](size_t i) {
+            Sink = Sink + registry.getLandAt(queries[i].first, queries[i].second, 0).size();
+        });
+        rows.push_back(makeRow(name, "box", stats));
+    }
+
+    // refresh: 随机平移领地
+    {
+        std::vector<std::pair<LandID, LandAABB>> moves(std::min(opt.ops / 10, world.lands.size()));
+        std::uniform_int_distribution<LandID>    pick{0, static_cast<LandID>(world.lands.size()) - 1};
+        std::uniform_int_distribution<int>       offset{-32, 32};
+        for (auto& [id, range] : moves) {
+            id       = pick(rng);
+            range    = world.lands[static_cast<size_t>(id)].range;
+            int dx   = offset(rng);
+            int dz   = offset(rng);
+            range.min.x += dx;
+            range.max.x += dx;
+            range.min.z += dz;
+            range.max.z += dz;
+        }
+
+        BenchStats stats;
+        stats.run(moves.size(), [&](size_t i) { registry.refreshLandRange(moves[i].first, moves[i].second); });
+        rows.push_back(makeRow(name, "refresh", stats));
+    }
+
+    // remove
+    {
+        std::vector<LandID> ids(world.lands.size());
+        for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<LandID>(i);
+        std::shuffle(ids.begin(), ids.end(), rng);
+        ids.resize(std::min(ids.size(), opt.ops / 10));
+
+        BenchStats stats;
+        stats.run(ids.size(), [&](size_t i) { Sink = Sink + registry.removeLand(ids[i]); });
+        rows.push_back(makeRow(name, "remove", stats));
+    }
+}
+
+void runAABB(Options const& opt, std::vector<Row>& rows) {
+    auto         world = generateWorld(WorldSpec{WorldKind::Uniform, opt.lands, opt.seed});
+    auto const&  lands = world.lands;
+    std::mt19937 rng{opt.seed};
+    std::uniform_int_distribution<size_t> pick{0, lands.size() - 1};
+
+    std::vector<std::pair<size_t, size_t>> pairs(opt.ops);
+    for (auto& [a, b] : pairs) {
+        a = pick(rng);
+        b = pick(rng);
+    }
+
+    {
+        BenchStats stats;
+        stats.run(pairs.size(), [&](size_t i) {
+            Sink = Sink + LandAABB::isCollision(lands[pairs[i].first].range, lands[pairs[i].second].range);
+        });
+        rows.push_back(makeRow("aabb", "isCollision", stats));
+    }
+    {
+        BenchStats stats;
+        stats.run(opt.ops / 10, [&](size_t i) { Sink = Sink + lands[pairs[i].first].range.getChunks().size(); });
+        rows.push_back(makeRow("aabb", "getChunks", stats));
+    }
+    {
+        BenchStats stats;
+        stats.run(pairs.size(), [&](size_t i) {
+            auto id = land::LandDimensionChunkMap::EncodeChunkID(static_cast<int>(pairs[i].first), -static_cast<int>(i));
+            Sink    = Sink + land::LandDimensionChunkMap::DecodeChunkID(id).first;
+        });
+        rows.push_back(makeRow("aabb", "encodeChunkID", stats));
+    }
+
+    // LandAABBTree: 构建一次，按随机范围查询
+    {
+        std::vector<land::LandAABBTree<size_t>::Item> items;
+        items.reserve(lands.size());
+        for (size_t i = 0; i < lands.size(); ++i) items.emplace_back(lands[i].range, i);
+
+        BenchStats build;
+        build.run(1, [&](size_t) {
+            land::LandAABBTree<size_t> tree{items};
+            Sink = Sink + tree.size();
+        });
+        rows.push_back(makeRow("aabb", "treeBuild", build));
+
+        land::LandAABBTree<size_t> tree{std::move(items)};
+        BenchStats                 query;
+        query.run(opt.ops / 4, [&](size_t i) {
+            auto range = lands[pairs[i].first].range.expanded(16);
+            tree.query(range, [](LandAABB const&, size_t) {
+                Sink = Sink + 1;
+                return true;
+            });
+        });
+        rows.push_back(makeRow("aabb", "treeQuery", query));
+    }
+}
+
+void printUsage(std::FILE* out) {
+    fmt::print(
+        out,
+        "usage:\n"
+        "  PLandBench [--lands N] [--ops N] [--seed S] [--scenario uniform|towns|nested|huge|all]\n"
+        "             [--csv <file>] [--baseline <file>] [--help]\n"
+        "  PLandBench trace gen|replay ...   (PLandBench trace --help)\n"
+        "  PLandBench journal [--dir <dir>]  (land journal self-checks)\n"
+    );
+}
+
+bool parseOptions(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            opt.help = true; // 无参数选项
+            continue;
+        }
+        if (i + 1 >= argc) {
+            fmt::print(stderr, "missing value for {}\n", arg);
+            return false;
+        }
+        std::string_view value = argv[++i];
+
+        bool ok = true;
+        if (arg == "--lands") {
+            ok = parseNumber(value, opt.lands) && opt.lands > 0;
+        } else if (arg == "--ops") {
+            ok = parseNumber(value, opt.ops) && opt.ops > 0;
+        } else if (arg == "--seed") {
+            ok = parseNumber(value, opt.seed);
+        } else if (arg == "--scenario") {
+            if (value != "all") {
+                auto kind = parseWorldKind(value);
+                ok        = kind.has_value();
+                if (ok) opt.scenarios = {*kind};
+            }
+        } else if (arg == "--csv") {
+            opt.csv = value;
+        } else if (arg == "--baseline") {
+            opt.baseline = value;
+        } else {
+            fmt::print(stderr, "unknown option: {}\n", arg);
+            return false;
+        }
+        if (!ok) {
+            fmt::print(stderr, "invalid value for {}: {}\n", arg, value);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+} // namespace bench
+
+
+int main(int argc, char** argv) {
+    using namespace bench;
+
+    if (argc >= 2 && std::string_view{argv[1]} == "trace") {
+        return runTraceCommand(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && std::string_view{argv[1]} == "journal") {
+        return runJournalCommand(argc - 2, argv + 2);
+    }
+
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        printUsage(stderr);
+        return 1;
+    }
+    if (opt.help) {
+        printUsage(stdout);
+        return 0;
+    }
+    fmt::print("PLandBench lands={} ops={} seed={}\n\n", opt.lands, opt.ops, opt.seed);
+
+    std::vector<Row> rows;
+    for (auto kind : opt.scenarios) {
+        runScenario(kind, opt, rows);
+    }
+    runAABB(opt, rows);
+
+    report(rows, opt.csv, opt.baseline);
+    return 0;
+}
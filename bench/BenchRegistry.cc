@@ -0,0 +1,85 @@
+#include "BenchRegistry.h"
+#include <algorithm>
+#include <mutex>
+
+
+namespace bench {
+
+LandID BenchRegistry::addLand(SharedBenchLand land) {
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+
+    land->id = mNextId++;
+    mLandCache.emplace(land->id, land);
+    mDimensionChunkMap.addLand(land->dimId, land->id, land->range);
+    return land->id;
+}
+
+bool BenchRegistry::removeLand(LandID id) {
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+
+    auto iter = mLandCache.find(id);
+    if (iter == mLandCache.end()) {
+        return false;
+    }
+    mDimensionChunkMap.removeLand(iter->second->dimId, id);
+    mLandCache.erase(iter);
+    return true;
+}
+
+bool BenchRegistry::refreshLandRange(LandID id, LandAABB const& newRange) {
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+
+    auto iter = mLandCache.find(id);
+    if (iter == mLandCache.end()) {
+        return false;
+    }
+    auto& land = iter->second;
+    land->range = newRange;
+    mDimensionChunkMap.refreshRange(land->dimId, id, land->range);
+    return true;
+}
+
+SharedBenchLand BenchRegistry::getLand(LandID id) const {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+
+    auto iter = mLandCache.find(id);
+    return iter == mLandCache.end() ? nullptr : iter->second;
+}
+
+size_t BenchRegistry::size() const {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return mLandCache.size();
+}
+
+void BenchRegistry::addOperator(UUIDs const& uuid) {
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    mLandOperators.push_back(uuid);
+}
+
+bool BenchRegistry::isOperator(UUIDs const& uuid) const {
+    if (uuid.empty()) return false;
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return std::find(mLandOperators.begin(), mLandOperators.end(), uuid) != mLandOperators.end();
+}
+
+
+// 查询与 LandRegistry::getLandAt 使用同一份实现(land_query)
+SharedBenchLand BenchRegistry::getLandAt(BlockPos const& pos, LandDimid dimid) const {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land::land_query::landAt(mDimensionChunkMap, mLandCache, pos, dimid);
+}
+
+std::unordered_set<SharedBenchLand>
+BenchRegistry::getLandAt(BlockPos const& center, int radius, LandDimid dimid) const {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land::land_query::landsInRadius(mDimensionChunkMap, mLandCache, center, radius, dimid);
+}
+
+std::unordered_set<SharedBenchLand>
+BenchRegistry::getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land::land_query::landsInRange(mDimensionChunkMap, mLandCache, pos1, pos2, dimid);
+}
+
+
+} // namespace bench
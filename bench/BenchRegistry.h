@@ -0,0 +1,104 @@
+#pragma once
+#include "mc/world/level/BlockPos.h"
+#include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/land/LandContext.h"
+#include "pland/land/LandDimensionChunkMap.h"
+#include "pland/land/LandQuery.h"
+#include <algorithm>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace bench {
+
+using land::LandAABB;
+using land::LandDimid;
+using land::LandID;
+using land::LandPermType;
+using land::UUIDs;
+
+
+/**
+ * @brief 基准测试用领地
+ * 只保留空间查询与权限检查需要的字段，嵌套层级在生成时预先计算
+ */
+struct BenchLand {
+    LandID              id{-1};
+    LandDimid           dimId{0};
+    LandAABB            range{};
+    bool                is3D{false};
+    LandID              parentId{-1};
+    int                 nestedLevel{0};
+    UUIDs               owner{};
+    std::vector<UUIDs>  members{};
+    land::LandPermTable permTable{};
+
+    // 与 Land::getPermType 保持一致
+    [[nodiscard]] LandPermType getPermType(UUIDs const& uuid) const {
+        if (uuid.empty()) return LandPermType::Guest;
+        if (owner == uuid) return LandPermType::Owner;
+        if (std::ranges::find(members, uuid) != members.end()) return LandPermType::Member;
+        return LandPermType::Guest;
+    }
+};
+using SharedBenchLand = std::shared_ptr<BenchLand>;
+
+
+} // namespace bench
+
+
+template <>
+struct land::LandQueryTraits<bench::BenchLand> {
+    static LandAABB const& aabb(bench::BenchLand const& land) { return land.range; }
+    static bool            is3D(bench::BenchLand const& land) { return land.is3D; }
+    static int             nestedLevel(bench::BenchLand const& land) { return land.nestedLevel; }
+};
+
+
+namespace bench {
+
+
+/**
+ * @brief 领地注册表核心
+ * 与 LandRegistry 的内存结构(领地缓存 + LandDimensionChunkMap + 读写锁)保持一致，getLandAt 直接调用
+ * LandRegistry 使用的 land_query，不包含数据库与事件，用于在没有 LeviLamina 的环境下测量索引性能
+ * @note 领地ID按插入顺序从 0 分配
+ */
+class BenchRegistry {
+public:
+    LandID addLand(SharedBenchLand land);
+
+    bool removeLand(LandID id);
+
+    bool refreshLandRange(LandID id, LandAABB const& newRange);
+
+    [[nodiscard]] SharedBenchLand getLand(LandID id) const;
+
+    [[nodiscard]] size_t size() const;
+
+    void addOperator(UUIDs const& uuid);
+
+    [[nodiscard]] bool isOperator(UUIDs const& uuid) const;
+
+    [[nodiscard]] SharedBenchLand getLandAt(BlockPos const& pos, LandDimid dimid) const;
+
+    [[nodiscard]] std::unordered_set<SharedBenchLand> getLandAt(BlockPos const& center, int radius, LandDimid dimid)
+        const;
+
+    [[nodiscard]] std::unordered_set<SharedBenchLand>
+    getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const;
+
+private:
+    std::vector<UUIDs>                          mLandOperators;
+    std::unordered_map<LandID, SharedBenchLand> mLandCache;
+    land::LandDimensionChunkMap                 mDimensionChunkMap;
+    mutable std::shared_mutex                   mMutex;
+    LandID                                      mNextId{0};
+};
+
+
+} // namespace bench
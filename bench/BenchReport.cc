@@ -0,0 +1,105 @@
+#include "BenchReport.h"
+#include "fmt/format.h"
+#include <fstream>
+#include <map>
+#include <sstream>
+
+
+namespace bench {
+
+namespace {
+
+std::map<std::string, Row> loadBaseline(std::string const& path) {
+    std::map<std::string, Row> result;
+    std::ifstream              file{path};
+    std::string                line;
+    std::getline(file, line); // 表头
+    while (std::getline(file, line)) {
+        std::stringstream ss{line};
+        Row               row;
+        std::string       cell;
+        std::getline(ss, row.scenario, ',');
+        std::getline(ss, row.op, ',');
+        std::getline(ss, cell, ',');
+        row.ops = std::stoull(cell);
+        std::getline(ss, cell, ',');
+        row.opsPerSecond = std::stod(cell);
+        result[row.scenario + "/" + row.op] = row;
+    }
+    return result;
+}
+
+} // namespace
+
+
+Row makeRow(std::string_view scenario, std::string_view op, BenchStats& stats) {
+    return Row{
+        std::string{scenario},
+        std::string{op},
+        stats.ops(),
+        stats.opsPerSecond(),
+        stats.percentile(0.5),
+        stats.percentile(0.9),
+        stats.percentile(0.99),
+        stats.percentile(1.0)
+    };
+}
+
+void report(std::vector<Row> const& rows, std::string const& csv, std::string const& baseline) {
+    std::map<std::string, Row> baselineRows;
+    if (!baseline.empty()) {
+        baselineRows = loadBaseline(baseline);
+    }
+
+    fmt::print(
+        "{:<8} {:<14} {:>9} {:>14} {:>10} {:>10} {:>10} {:>12}{}\n",
+        "scenario",
+        "op",
+        "ops",
+        "ops/s",
+        "p50(ns)",
+        "p90(ns)",
+        "p99(ns)",
+        "max(ns)",
+        baselineRows.empty() ? "" : "   vs baseline"
+    );
+    for (auto const& row : rows) {
+        std::string delta;
+        if (auto iter = baselineRows.find(row.scenario + "/" + row.op); iter != baselineRows.end()) {
+            delta = fmt::format("   {:+.1f}%", (row.opsPerSecond / iter->second.opsPerSecond - 1.0) * 100.0);
+        }
+        fmt::print(
+            "{:<8} {:<14} {:>9} {:>14.0f} {:>10.1f} {:>10.1f} {:>10.1f} {:>12.1f}{}\n",
+            row.scenario,
+            row.op,
+            row.ops,
+            row.opsPerSecond,
+            row.p50,
+            row.p90,
+            row.p99,
+            row.max,
+            delta
+        );
+    }
+
+    if (!csv.empty()) {
+        std::ofstream file{csv};
+        file << "scenario,op,ops,ops_per_sec,p50_ns,p90_ns,p99_ns,max_ns\n";
+        for (auto const& row : rows) {
+            file << fmt::format(
+                "{},{},{},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f}\n",
+                row.scenario,
+                row.op,
+                row.ops,
+                row.opsPerSecond,
+                row.p50,
+                row.p90,
+                row.p99,
+                row.max
+            );
+        }
+    }
+}
+
+
+} // namespace bench
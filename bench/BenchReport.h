@@ -0,0 +1,43 @@
+#pragma once
+#include "BenchStats.h"
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace bench {
+
+
+/**
+ * @brief 结果表中的一行
+ */
+struct Row {
+    std::string scenario;
+    std::string op;
+    size_t      ops{0};
+    double      opsPerSecond{0};
+    double      p50{0}, p90{0}, p99{0}, max{0};
+};
+
+[[nodiscard]] Row makeRow(std::string_view scenario, std::string_view op, BenchStats& stats);
+
+/**
+ * @brief 打印结果表
+ * @param csv 非空时同时写出 CSV
+ * @param baseline 非空时读取之前写出的 CSV，打印吞吐量变化
+ */
+void report(std::vector<Row> const& rows, std::string const& csv = {}, std::string const& baseline = {});
+
+/**
+ * @brief 解析命令行数值参数，要求整个字符串都是数字
+ */
+template <typename T>
+bool parseNumber(std::string_view text, T& out) {
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+
+} // namespace bench
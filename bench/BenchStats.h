@@ -0,0 +1,79 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+
+namespace bench {
+
+
+/**
+ * @brief 操作耗时统计
+ * 按批计时(避免时钟开销淹没纳秒级操作)，每批的平均耗时作为一个样本
+ */
+class BenchStats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t BatchSize = 8; // 每批操作数
+
+    /**
+     * @brief 执行 count 次 fn(i)，按批记录耗时
+     */
+    template <typename Fn>
+    void run(size_t count, Fn&& fn) {
+        mSamples.reserve(mSamples.size() + count / BatchSize + 1);
+        for (size_t begin = 0; begin < count; begin += BatchSize) {
+            size_t end   = std::min(begin + BatchSize, count);
+            auto   start = Clock::now();
+            for (size_t i = begin; i < end; ++i) {
+                fn(i);
+            }
+            auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            mSamples.push_back(elapsed / static_cast<double>(end - begin));
+            mTotalNs += elapsed;
+            mOps     += end - begin;
+        }
+        mSorted = false;
+    }
+
+    /**
+     * @brief 记录单次操作耗时(纳秒)，用于无法分批计时的交错操作
+     */
+    void record(double ns) {
+        mSamples.push_back(ns);
+        mTotalNs += ns;
+        ++mOps;
+        mSorted = false;
+    }
+
+    [[nodiscard]] size_t ops() const { return mOps; }
+
+    [[nodiscard]] double opsPerSecond() const { return mTotalNs > 0 ? static_cast<double>(mOps) * 1e9 / mTotalNs : 0; }
+
+    /**
+     * @brief 单次操作耗时分位数(纳秒)
+     * @param p 0.0 ~ 1.0
+     */
+    [[nodiscard]] double percentile(double p) {
+        if (mSamples.empty()) {
+            return 0;
+        }
+        if (!mSorted) {
+            std::sort(mSamples.begin(), mSamples.end());
+            mSorted = true;
+        }
+        auto index = static_cast<size_t>(std::clamp(p, 0.0, 1.0) * static_cast<double>(mSamples.size() - 1) + 0.5);
+        return mSamples[index];
+    }
+
+private:
+    std::vector<double> mSamples;
+    double              mTotalNs{0};
+    size_t              mOps{0};
+    bool                mSorted{false};
+};
+
+
+} // namespace bench
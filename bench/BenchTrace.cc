@@ -0,0 +1,625 @@
+#include "BenchTrace.h"
+#include "BenchReport.h"
+#include "BenchStats.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+
+namespace bench {
+
+namespace {
+
+using land::LandPos;
+
+constexpr char     TraceMagic[4] = {'P', 'L', 'T', 'R'};
+constexpr uint32_t TraceVersion  = 1;
+constexpr size_t   RecordSize    = 32; // u8 type, u8 reserved, u16 player, i32 dim, i32 pos[3], i32 arg[3]
+
+constexpr size_t MassTeleportInterval = 5000; // 每隔多少个事件发生一次集体传送
+constexpr size_t MassTeleportPlayers  = 200;  // 集体传送的玩家数量
+constexpr size_t RedstoneFarmCount    = 32;   // 红石机器数量
+constexpr int    LandMinSpacing       = 16;   // Config::cfg.land.minSpacing 默认值
+
+int uniform(std::mt19937& rng, int min, int max) { return std::uniform_int_distribution<int>{min, max}(rng); }
+
+BlockPos jitter(std::mt19937& rng, BlockPos const& pos, int radius) {
+    return BlockPos{
+        pos.x + uniform(rng, -radius, radius),
+        pos.y + uniform(rng, -std::min(radius, 4), std::min(radius, 4)),
+        pos.z + uniform(rng, -radius, radius)
+    };
+}
+
+bool endsWith(std::string_view str, std::string_view suffix) {
+    return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+}
+
+
+// 二进制格式(小端): 头部 32 字节 + 每个事件 RecordSize 字节
+template <typename T>
+void put(std::string& out, T value) {
+    char buf[sizeof(T)];
+    std::memcpy(buf, &value, sizeof(T));
+    out.append(buf, sizeof(T));
+}
+
+template <typename T>
+T get(char const*& in) {
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return value;
+}
+
+bool writeBinary(Trace const& trace, std::string const& path) {
+    std::string out;
+    out.reserve(32 + trace.events.size() * RecordSize);
+    out.append(TraceMagic, sizeof(TraceMagic));
+    put<uint32_t>(out, TraceVersion);
+    put<uint8_t>(out, static_cast<uint8_t>(trace.world.kind));
+    put<uint8_t>(out, 0);
+    put<uint16_t>(out, 0);
+    put<uint32_t>(out, trace.world.seed);
+    put<uint32_t>(out, trace.world.players);
+    put<uint32_t>(out, static_cast<uint32_t>(trace.world.landCount));
+    put<uint64_t>(out, trace.events.size());
+
+    for (auto const& ev : trace.events) {
+        put<uint8_t>(out, static_cast<uint8_t>(ev.type));
+        put<uint8_t>(out, 0);
+        put<uint16_t>(out, ev.player);
+        put<int32_t>(out, ev.dimId);
+        for (auto const& p : {ev.pos, ev.arg}) {
+            put<int32_t>(out, p.x);
+            put<int32_t>(out, p.y);
+            put<int32_t>(out, p.z);
+        }
+    }
+
+    std::ofstream file{path, std::ios::binary};
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    return file.good();
+}
+
+std::optional<Trace> readBinary(std::string const& data) {
+    if (data.size() < 32 || std::memcmp(data.data(), TraceMagic, sizeof(TraceMagic)) != 0) {
+        return std::nullopt;
+    }
+    char const* in = data.data() + sizeof(TraceMagic);
+    if (get<uint32_t>(in) != TraceVersion) {
+        return std::nullopt;
+    }
+
+    auto kind = get<uint8_t>(in);
+    if (kind > static_cast<uint8_t>(WorldKind::Huge)) {
+        return std::nullopt;
+    }
+    in += 3; // reserved
+
+    Trace trace;
+    trace.world.kind      = static_cast<WorldKind>(kind);
+    trace.world.seed      = get<uint32_t>(in);
+    trace.world.players   = get<uint32_t>(in);
+    trace.world.landCount = get<uint32_t>(in);
+    auto count            = get<uint64_t>(in);
+    if (data.size() != 32 + count * RecordSize) {
+        return std::nullopt;
+    }
+
+    trace.events.resize(count);
+    for (auto& ev : trace.events) {
+        ev.type = static_cast<TraceEventType>(get<uint8_t>(in));
+        in++; // reserved
+        ev.player = get<uint16_t>(in);
+        ev.dimId  = get<int32_t>(in);
+        for (auto* p : {&ev.pos, &ev.arg}) {
+            p->x = get<int32_t>(in);
+            p->y = get<int32_t>(in);
+            p->z = get<int32_t>(in);
+        }
+        if (ev.type >= TraceEventType::Count) {
+            return std::nullopt;
+        }
+    }
+    return trace;
+}
+
+
+// JSONL: 首行为世界参数，其余每行一个事件，字段均为整数或字符串
+bool writeJsonl(Trace const& trace, std::string const& path) {
+    std::ofstream file{path};
+    file << fmt::format(
+        R"({{"world":"{}","lands":{},"seed":{},"players":{}}})"
+        "\n",
+        toString(trace.world.kind),
+        trace.world.landCount,
+        trace.world.seed,
+        trace.world.players
+    );
+    for (auto const& ev : trace.events) {
+        file << fmt::format(
+            R"({{"t":"{}","p":{},"d":{},"pos":[{},{},{}],"arg":[{},{},{}]}})"
+            "\n",
+            toString(ev.type),
+            ev.player,
+            ev.dimId,
+            ev.pos.x,
+            ev.pos.y,
+            ev.pos.z,
+            ev.arg.x,
+            ev.arg.y,
+            ev.arg.z
+        );
+    }
+    return file.good();
+}
+
+std::string_view findValue(std::string_view line, std::string_view key) {
+    auto pattern = fmt::format("\"{}\":", key);
+    auto pos     = line.find(pattern);
+    if (pos == std::string_view::npos) {
+        return {};
+    }
+    line      = line.substr(pos + pattern.size());
+    auto end  = line.find_first_of(line.starts_with('[') ? "]" : ",}");
+    auto size = end == std::string_view::npos ? line.size() : end + (line.starts_with('[') ? 1 : 0);
+    return line.substr(0, size);
+}
+
+template <typename T>
+bool findNumber(std::string_view line, std::string_view key, T& out) {
+    return parseNumber(findValue(line, key), out);
+}
+
+bool findString(std::string_view line, std::string_view key, std::string_view& out) {
+    auto value = findValue(line, key);
+    if (value.size() < 2 || value.front() != '"' || value.back() != '"') {
+        return false;
+    }
+    out = value.substr(1, value.size() - 2);
+    return true;
+}
+
+bool findPos(std::string_view line, std::string_view key, BlockPos& out) {
+    auto value = findValue(line, key);
+    if (value.size() < 2 || value.front() != '[' || value.back() != ']') {
+        return false;
+    }
+    value = value.substr(1, value.size() - 2);
+    int* fields[3]{&out.x, &out.y, &out.z};
+    for (int i = 0; i < 3; ++i) {
+        auto comma = value.find(',');
+        if (!parseNumber(value.substr(0, comma), *fields[i])) {
+            return false;
+        }
+        value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+    }
+    return true;
+}
+
+std::optional<Trace> readJsonl(std::string const& data) {
+    Trace            trace;
+    std::string_view rest = data;
+    bool             head = true;
+    while (!rest.empty()) {
+        auto             eol  = rest.find('\n');
+        std::string_view line = rest.substr(0, eol);
+        rest                  = eol == std::string_view::npos ? std::string_view{} : rest.substr(eol + 1);
+        if (line.empty()) {
+            continue;
+        }
+
+        if (head) {
+            std::string_view world;
+            if (!findString(line, "world", world) || !findNumber(line, "lands", trace.world.landCount)
+                || !findNumber(line, "seed", trace.world.seed) || !findNumber(line, "players", trace.world.players)) {
+                return std::nullopt;
+            }
+            auto kind = parseWorldKind(world);
+            if (!kind) {
+                return std::nullopt;
+            }
+            trace.world.kind = *kind;
+            head             = false;
+            continue;
+        }
+
+        TraceEvent       ev;
+        std::string_view type;
+        if (!findString(line, "t", type) || !findNumber(line, "p", ev.player) || !findNumber(line, "d", ev.dimId)
+            || !findPos(line, "pos", ev.pos) || !findPos(line, "arg", ev.arg)) {
+            return std::nullopt;
+        }
+        ev.type = TraceEventType::Count;
+        for (size_t i = 0; i < TraceEventTypeCount; ++i) {
+            if (toString(static_cast<TraceEventType>(i)) == type) {
+                ev.type = static_cast<TraceEventType>(i);
+            }
+        }
+        if (ev.type == TraceEventType::Count) {
+            return std::nullopt;
+        }
+        trace.events.push_back(ev);
+    }
+    if (head) {
+        return std::nullopt;
+    }
+    return trace;
+}
+
+
+/**
+ * @brief 回放状态
+ * 各处理函数与 hooks/listeners 及 LandScheduler 中的检查逻辑保持一致，返回事件是否被拦截
+ */
+class Replayer {
+public:
+    explicit Replayer(Trace const& trace) : mWorld(generateWorld(trace.world)) {
+        for (auto const& land : mWorld.lands) {
+            mRegistry.addLand(std::make_shared<BenchLand>(land));
+        }
+        for (uint32_t i = 0; i < std::max(trace.world.players, 1u); ++i) {
+            mPlayers.push_back(playerUuid(i));
+        }
+        mRegistry.addOperator(mPlayers.front()); // 0 号玩家为领地操作员
+        mLastLand.assign(mPlayers.size(), -1);
+    }
+
+    [[nodiscard]] size_t landCount() const { return mRegistry.size(); }
+
+    bool handle(TraceEvent const& ev) {
+        auto const& uuid = mPlayers[ev.player % mPlayers.size()];
+        switch (ev.type) {
+        case TraceEventType::BlockBreak: {
+            auto land = mRegistry.getLandAt(ev.pos, ev.dimId);
+            if (preCheck(land, uuid)) return false;
+            return !land->permTable.allowDestroy;
+        }
+        case TraceEventType::BlockPlace: {
+            auto land = mRegistry.getLandAt(ev.pos, ev.dimId);
+            if (preCheck(land, uuid)) return false;
+            return !land->permTable.allowPlace;
+        }
+        case TraceEventType::Redstone: {
+            auto land = mRegistry.getLandAt(ev.pos, ev.dimId);
+            return !(preCheck(land) || (land && land->permTable.allowRedstoneUpdate));
+        }
+        case TraceEventType::PistonPush: {
+            auto pistonLand = mRegistry.getLandAt(ev.pos, ev.dimId);
+            auto pushLand   = mRegistry.getLandAt(ev.arg, ev.dimId);
+            if (pistonLand && pushLand) {
+                return !(
+                    pistonLand == pushLand
+                    || (pistonLand->permTable.allowPistonPushOnBoundary && pushLand->permTable.allowPistonPushOnBoundary)
+                );
+            }
+            if (!pistonLand && pushLand) {
+                return !pushLand->permTable.allowPistonPushOnBoundary
+                    && (pushLand->range.isOnOuterBoundary(ev.pos) || pushLand->range.isOnInnerBoundary(ev.arg));
+            }
+            return false;
+        }
+        case TraceEventType::Explosion: {
+            for (auto& land : mRegistry.getLandAt(ev.pos, ev.arg.x + 1, ev.dimId)) {
+                if (!land->permTable.allowExplode) return true;
+            }
+            return false;
+        }
+        case TraceEventType::WitherDestroy: {
+            for (auto& land : mRegistry.getLandAt(ev.pos, ev.arg, ev.dimId)) {
+                if (!land->permTable.allowWitherDestroy) return true;
+            }
+            return false;
+        }
+        case TraceEventType::PlayerMove: {
+            auto   land    = mRegistry.getLandAt(ev.pos, ev.dimId);
+            LandID current = land ? land->id : -1;
+            auto&  last    = mLastLand[ev.player % mLastLand.size()];
+            if (current != last) {
+                last = current; // 进入/离开领地
+                return true;
+            }
+            return false;
+        }
+        case TraceEventType::LandPurchase: {
+            LandAABB range{
+                LandPos{ev.pos.x, ev.pos.y, ev.pos.z},
+                LandPos{ev.arg.x, ev.arg.y, ev.arg.z}
+            };
+            range.fix();
+            auto expanded = range.expanded(LandMinSpacing);
+            for (auto& other : mRegistry.getLandAt(expanded.min.as(), expanded.max.as(), ev.dimId)) {
+                if (LandAABB::isCollision(other->range, range)
+                    || !LandAABB::isComplisWithMinSpacing(other->range, range, LandMinSpacing)) {
+                    return true;
+                }
+            }
+            auto land   = std::make_shared<BenchLand>();
+            land->range = range;
+            land->owner = uuid;
+            mRegistry.addLand(land);
+            return false;
+        }
+        case TraceEventType::Count:
+            break;
+        }
+        return false;
+    }
+
+private:
+    // 与 PreCheckLandExistsAndPermission 保持一致
+    bool preCheck(SharedBenchLand const& land, UUIDs const& uuid = {}) const {
+        return !land || mRegistry.isOperator(uuid) || land->getPermType(uuid) != LandPermType::Guest;
+    }
+
+    GeneratedWorld      mWorld;
+    BenchRegistry       mRegistry;
+    std::vector<UUIDs>  mPlayers;
+    std::vector<LandID> mLastLand; // 每名玩家上一次所在的领地
+};
+
+
+int runGen(int argc, char** argv) {
+    TraceSpec   spec;
+    std::string out;
+    for (int i = 0; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (i + 1 >= argc) {
+            fmt::print(stderr, "missing value for {}\n", arg);
+            return 1;
+        }
+        std::string_view value = argv[++i];
+
+        bool ok = true;
+        if (arg == "--world") {
+            auto kind = parseWorldKind(value);
+            ok        = kind.has_value();
+            if (ok) spec.world.kind = *kind;
+        } else if (arg == "--lands") {
+            ok = parseNumber(value, spec.world.landCount) && spec.world.landCount > 0;
+        } else if (arg == "--players") {
+            ok = parseNumber(value, spec.world.players) && spec.world.players > 0 && spec.world.players <= 0xFFFF;
+        } else if (arg == "--events") {
+            ok = parseNumber(value, spec.eventCount);
+        } else if (arg == "--seed") {
+            ok = parseNumber(value, spec.world.seed);
+        } else if (arg == "--out") {
+            out = value;
+        } else {
+            fmt::print(stderr, "unknown option: {}\n", arg);
+            return 1;
+        }
+        if (!ok) {
+            fmt::print(stderr, "invalid value for {}: {}\n", arg, value);
+            return 1;
+        }
+    }
+    if (out.empty()) {
+        fmt::print(stderr, "missing --out\n");
+        return 1;
+    }
+
+    auto trace = generateTrace(generateWorld(spec.world), spec);
+    if (!writeTrace(trace, out)) {
+        fmt::print(stderr, "failed to write {}\n", out);
+        return 1;
+    }
+    fmt::print(
+        "wrote {} events ({} world, {} lands, {} players, seed {}) to {}\n",
+        trace.events.size(),
+        toString(spec.world.kind),
+        spec.world.landCount,
+        spec.world.players,
+        spec.world.seed,
+        out
+    );
+    return 0;
+}
+
+int runReplay(int argc, char** argv) {
+    if (argc < 1) {
+        fmt::print(stderr, "missing trace file\n");
+        return 1;
+    }
+    std::string path = argv[0];
+    std::string csv;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--csv" && i + 1 < argc) {
+            csv = argv[++i];
+        } else {
+            fmt::print(stderr, "unknown option: {}\n", arg);
+            return 1;
+        }
+    }
+
+    auto trace = readTrace(path);
+    if (!trace) {
+        fmt::print(stderr, "failed to read trace {}\n", path);
+        return 1;
+    }
+
+    Replayer replayer{*trace};
+    fmt::print(
+        "replaying {} events against {} lands ({} world, seed {})\n\n",
+        trace->events.size(),
+        replayer.landCount(),
+        toString(trace->world.kind),
+        trace->world.seed
+    );
+
+    // 事件类型交错，逐个计时
+    using Clock = BenchStats::Clock;
+    std::array<BenchStats, TraceEventTypeCount> stats;
+    std::array<size_t, TraceEventTypeCount>      hits{};
+    for (auto const& ev : trace->events) {
+        auto begin = Clock::now();
+        bool hit   = replayer.handle(ev);
+        auto ns    = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+
+        auto index = static_cast<size_t>(ev.type);
+        stats[index].record(ns);
+        hits[index] += hit;
+    }
+
+    std::vector<Row> rows;
+    for (size_t i = 0; i < TraceEventTypeCount; ++i) {
+        if (stats[i].ops() == 0) continue;
+        rows.push_back(makeRow("replay", toString(static_cast<TraceEventType>(i)), stats[i]));
+    }
+    report(rows, csv);
+
+    // 拦截: 方块/红石/活塞/爆炸/凋零为取消事件，移动为进出领地，购买为范围冲突
+    fmt::print("\n");
+    for (size_t i = 0; i < TraceEventTypeCount; ++i) {
+        if (stats[i].ops() == 0) continue;
+        fmt::print("{:<14} hit {:>9} / {}\n", toString(static_cast<TraceEventType>(i)), hits[i], stats[i].ops());
+    }
+    fmt::print("lands after replay: {}\n", replayer.landCount());
+    return 0;
+}
+
+} // namespace
+
+
+std::string_view toString(TraceEventType type) {
+    switch (type) {
+    case TraceEventType::BlockBreak:
+        return "break";
+    case TraceEventType::BlockPlace:
+        return "place";
+    case TraceEventType::Redstone:
+        return "redstone";
+    case TraceEventType::PistonPush:
+        return "piston";
+    case TraceEventType::Explosion:
+        return "explosion";
+    case TraceEventType::WitherDestroy:
+        return "wither";
+    case TraceEventType::PlayerMove:
+        return "move";
+    case TraceEventType::LandPurchase:
+        return "purchase";
+    case TraceEventType::Count:
+        break;
+    }
+    return "unknown";
+}
+
+Trace generateTrace(GeneratedWorld const& world, TraceSpec const& spec) {
+    std::mt19937 rng{spec.world.seed ^ 0x5BD1E995u};
+    Trace        trace;
+    trace.world = spec.world;
+    trace.events.reserve(spec.eventCount);
+
+    auto const players = std::max(spec.world.players, 1u);
+
+    // 每名玩家的活动中心(大多位于领地内)，以及固定位置的红石机器
+    std::vector<BlockPos> focus(players);
+    for (auto& pos : focus) pos = randomQueryPos(world, rng, 0.9);
+    std::vector<BlockPos> farms(RedstoneFarmCount);
+    for (auto& pos : farms) pos = randomQueryPos(world, rng, 1.0);
+
+    // 权重顺序与 TraceEventType 一致
+    std::discrete_distribution<int>         pickType{35, 20, 20, 4, 3, 1, 15, 2};
+    std::uniform_int_distribution<uint32_t> pickPlayer{0, players - 1};
+    std::uniform_int_distribution<size_t>   pickFarm{0, farms.size() - 1};
+
+    while (trace.events.size() < spec.eventCount) {
+        // 集体传送: 大量玩家在同一时刻传送到同一位置附近
+        if (!trace.events.empty() && trace.events.size() % MassTeleportInterval == 0) {
+            auto target = randomQueryPos(world, rng, 0.8);
+            auto count  = std::min({MassTeleportPlayers, static_cast<size_t>(players), spec.eventCount - trace.events.size()});
+            for (size_t i = 0; i < count; ++i) {
+                auto player   = static_cast<uint16_t>(i);
+                focus[player] = jitter(rng, target, 4);
+                trace.events.push_back(TraceEvent{TraceEventType::PlayerMove, player, 0, focus[player], {}});
+            }
+            continue;
+        }
+
+        TraceEvent ev;
+        ev.type   = static_cast<TraceEventType>(pickType(rng));
+        ev.player = static_cast<uint16_t>(pickPlayer(rng));
+        auto& pos = focus[ev.player];
+
+        switch (ev.type) {
+        case TraceEventType::BlockBreak:
+        case TraceEventType::BlockPlace:
+            if (std::bernoulli_distribution{0.02}(rng)) {
+                pos = randomQueryPos(world, rng, 0.9); // 换个地方
+            }
+            ev.pos = jitter(rng, pos, 8);
+            break;
+        case TraceEventType::Redstone:
+            ev.pos = jitter(rng, farms[pickFarm(rng)], 3);
+            break;
+        case TraceEventType::PistonPush:
+            ev.pos = jitter(rng, farms[pickFarm(rng)], 3);
+            ev.arg = BlockPos{ev.pos.x + 1, ev.pos.y, ev.pos.z};
+            break;
+        case TraceEventType::Explosion:
+            ev.pos = randomQueryPos(world, rng, 0.5);
+            ev.arg = BlockPos{uniform(rng, 3, 8), 0, 0};
+            break;
+        case TraceEventType::WitherDestroy:
+            ev.pos = randomQueryPos(world, rng, 0.5);
+            ev.arg = BlockPos{ev.pos.x + 3, ev.pos.y + 3, ev.pos.z + 3};
+            break;
+        case TraceEventType::PlayerMove:
+            pos    = jitter(rng, pos, 16);
+            ev.pos = pos;
+            break;
+        case TraceEventType::LandPurchase: {
+            ev.pos = randomQueryPos(world, rng, 0.0);
+            ev.pos.y = -64;
+            ev.arg   = BlockPos{ev.pos.x + uniform(rng, 16, 64), 320, ev.pos.z + uniform(rng, 16, 64)};
+            break;
+        }
+        case TraceEventType::Count:
+            break;
+        }
+        trace.events.push_back(ev);
+    }
+    return trace;
+}
+
+bool writeTrace(Trace const& trace, std::string const& path) {
+    return endsWith(path, ".jsonl") ? writeJsonl(trace, path) : writeBinary(trace, path);
+}
+
+std::optional<Trace> readTrace(std::string const& path) {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        return std::nullopt;
+    }
+    std::string data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    return endsWith(path, ".jsonl") ? readJsonl(data) : readBinary(data);
+}
+
+int runTraceCommand(int argc, char** argv) {
+    if (argc >= 1 && std::string_view{argv[0]} == "gen") {
+        return runGen(argc - 1, argv + 1);
+    }
+    if (argc >= 1 && std::string_view{argv[0]} == "replay") {
+        return runReplay(argc - 1, argv + 1);
+    }
+    bool const help = argc >= 1 && (std::string_view{argv[0]} == "--help" || std::string_view{argv[0]} == "-h");
+    fmt::print(
+        help ? stdout : stderr,
+        "usage:\n"
+        "  trace gen [--world uniform|towns|nested|huge] [--lands N] [--players N] [--events N] [--seed S] --out "
+        "<file>\n"
+        "  trace replay <file> [--csv <file>]\n"
+        "files ending in .jsonl are JSON lines, anything else is the compact binary format\n"
+    );
+    return help ? 0 : 1;
+}
+
+
+} // namespace bench
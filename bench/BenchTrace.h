@@ -0,0 +1,81 @@
+#pragma once
+#include "BenchWorld.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace bench {
+
+
+/**
+ * @brief 回放事件类型，对应 hooks/listeners 中的监听器
+ */
+enum class TraceEventType : uint8_t {
+    BlockBreak = 0, // 玩家破坏方块     PlayerDestroyBlockEvent
+    BlockPlace,     // 玩家放置方块     PlayerPlacingBlockEvent
+    Redstone,       // 红石更新        RedstoneUpdateBeforeEvent
+    PistonPush,     // 活塞推动        PistonPushBeforeEvent
+    Explosion,      // 爆炸           ExplosionBeforeEvent
+    WitherDestroy,  // 凋零破坏        WitherDestroyBeforeEvent
+    PlayerMove,     // 玩家移动/传送    LandScheduler 进出领地检测
+    LandPurchase,   // 购买领地        LandCreateValidator::isLandRangeWithOtherCollision + 添加领地
+    Count
+};
+
+inline constexpr size_t TraceEventTypeCount = static_cast<size_t>(TraceEventType::Count);
+
+/**
+ * @brief 回放事件
+ * arg 的含义取决于类型:
+ * PistonPush 为被推动的位置；WitherDestroy / LandPurchase 为范围的另一个对角；Explosion 的 arg.x 为半径
+ */
+struct TraceEvent {
+    TraceEventType type{TraceEventType::BlockBreak};
+    uint16_t       player{0};
+    LandDimid      dimId{0};
+    BlockPos       pos{};
+    BlockPos       arg{};
+};
+
+struct TraceSpec {
+    WorldSpec world{};
+    size_t    eventCount{1000000};
+};
+
+/**
+ * @brief 事件轨迹
+ * 只记录世界参数，回放时由 generateWorld 重新生成相同的领地布局
+ */
+struct Trace {
+    WorldSpec               world{};
+    std::vector<TraceEvent> events;
+};
+
+[[nodiscard]] std::string_view toString(TraceEventType type);
+
+/**
+ * @brief 按种子确定性地生成事件轨迹
+ * 包含城镇中的方块破坏/放置、固定位置的红石机器、成批传送到同一位置以及购买领地
+ */
+[[nodiscard]] Trace generateTrace(GeneratedWorld const& world, TraceSpec const& spec);
+
+/**
+ * @brief 写入轨迹文件，扩展名为 .jsonl 时写 JSONL，否则写紧凑二进制
+ */
+bool writeTrace(Trace const& trace, std::string const& path);
+
+[[nodiscard]] std::optional<Trace> readTrace(std::string const& path);
+
+/**
+ * @brief trace 子命令入口
+ *   trace gen    [--world K] [--lands N] [--players N] [--events N] [--seed S] --out <文件>
+ *   trace replay <文件> [--csv <输出文件>]
+ */
+int runTraceCommand(int argc, char** argv);
+
+
+} // namespace bench
@@ -0,0 +1,204 @@
+#include "BenchWorld.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace bench {
+
+using land::LandPos;
+
+namespace {
+
+constexpr int WorldMinY = -64;
+constexpr int WorldMaxY = 320;
+
+int uniform(std::mt19937& rng, int min, int max) { return std::uniform_int_distribution<int>{min, max}(rng); }
+
+BenchLand makeLand(std::mt19937& rng, int x, int z, int sizeX, int sizeZ, double ratio3D) {
+    BenchLand land;
+    land.is3D = std::bernoulli_distribution{ratio3D}(rng);
+    int minY  = WorldMinY;
+    int maxY  = WorldMaxY;
+    if (land.is3D) {
+        minY = uniform(rng, -32, 100);
+        maxY = minY + uniform(rng, 8, 64);
+    }
+    land.range = LandAABB{
+        LandPos{x,         minY, z        },
+        LandPos{x + sizeX, maxY, z + sizeZ}
+    };
+    return land;
+}
+
+void generateUniform(GeneratedWorld& world, std::mt19937& rng, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        int size = uniform(rng, 16, 96);
+        world.lands.push_back(makeLand(
+            rng,
+            uniform(rng, -world.extent, world.extent - size),
+            uniform(rng, -world.extent, world.extent - size),
+            size,
+            uniform(rng, 16, 96),
+            0.3
+        ));
+    }
+}
+
+void generateTowns(GeneratedWorld& world, std::mt19937& rng, size_t count) {
+    size_t                           towns = std::max<size_t>(1, count / 200);
+    std::vector<std::pair<int, int>> centers;
+    for (size_t i = 0; i < towns; ++i) {
+        centers.emplace_back(uniform(rng, -world.extent, world.extent), uniform(rng, -world.extent, world.extent));
+    }
+
+    std::normal_distribution<double> offset{0, 300};
+    for (size_t i = 0; i < count; ++i) {
+        auto [cx, cz] = centers[i % towns];
+        world.lands.push_back(makeLand(
+            rng,
+            cx + static_cast<int>(offset(rng)),
+            cz + static_cast<int>(offset(rng)),
+            uniform(rng, 8, 32),
+            uniform(rng, 8, 32),
+            0.1
+        ));
+    }
+}
+
+// 每个父领地: 3 个子领地，每个子领地再含 2 个子领地(共 10 块)
+void generateNested(GeneratedWorld& world, std::mt19937& rng, size_t count) {
+    auto addChildren = [&](auto& self, size_t parentIndex, int depth, int fanout) -> void {
+        if (depth > 2 || world.lands.size() >= count) {
+            return;
+        }
+        auto parent = world.lands[parentIndex];
+        int  spanX  = parent.range.getDepth() / fanout;
+        int  spanZ  = parent.range.getWidth();
+        for (int i = 0; i < fanout && world.lands.size() < count; ++i) {
+            BenchLand sub;
+            sub.is3D        = true;
+            sub.parentId    = static_cast<LandID>(parentIndex);
+            sub.nestedLevel = parent.nestedLevel + 1;
+            sub.dimId       = parent.dimId;
+            int minX        = parent.range.min.x + i * spanX + 1;
+            int minY        = parent.range.min.y + depth;
+            sub.range       = LandAABB{
+                LandPos{minX,                                  minY,                         parent.range.min.z + 1},
+                LandPos{minX + std::max(1, spanX - 2), std::max(minY, parent.range.max.y - depth),
+                        parent.range.min.z + std::max(1, spanZ - 2)}
+            };
+            world.lands.push_back(sub);
+            self(self, world.lands.size() - 1, depth + 1, 2);
+        }
+    };
+
+    while (world.lands.size() < count) {
+        int size = uniform(rng, 128, 384);
+        world.lands.push_back(makeLand(
+            rng,
+            uniform(rng, -world.extent, world.extent - size),
+            uniform(rng, -world.extent, world.extent - size),
+            size,
+            size,
+            0.0
+        ));
+        world.lands.back().is3D = true; // 子领地只能在 3D 领地内创建
+        addChildren(addChildren, world.lands.size() - 1, 1, 3);
+    }
+}
+
+void generateHuge(GeneratedWorld& world, std::mt19937& rng, size_t count) {
+    size_t huge = std::min<size_t>(16, count);
+    for (size_t i = 0; i < huge; ++i) {
+        int size = uniform(rng, 4000, 16000);
+        world.lands.push_back(makeLand(
+            rng,
+            uniform(rng, -world.extent, std::max(-world.extent, world.extent - size / 2)),
+            uniform(rng, -world.extent, std::max(-world.extent, world.extent - size / 2)),
+            size,
+            size,
+            0.0
+        ));
+    }
+    generateUniform(world, rng, count - huge);
+}
+
+} // namespace
+
+
+std::string_view toString(WorldKind kind) {
+    switch (kind) {
+    case WorldKind::Uniform:
+        return "uniform";
+    case WorldKind::Towns:
+        return "towns";
+    case WorldKind::Nested:
+        return "nested";
+    case WorldKind::Huge:
+        return "huge";
+    }
+    return "unknown";
+}
+
+std::optional<WorldKind> parseWorldKind(std::string_view name) {
+    for (auto kind : {WorldKind::Uniform, WorldKind::Towns, WorldKind::Nested, WorldKind::Huge}) {
+        if (toString(kind) == name) {
+            return kind;
+        }
+    }
+    return std::nullopt;
+}
+
+UUIDs playerUuid(uint32_t index) { return fmt::format("00000000-0000-4000-8000-{:012x}", index); }
+
+GeneratedWorld generateWorld(WorldSpec const& spec) {
+    std::mt19937   rng{spec.seed};
+    GeneratedWorld world;
+    world.extent = std::max(2048, static_cast<int>(std::sqrt(static_cast<double>(spec.landCount)) * 160));
+    world.lands.reserve(spec.landCount);
+
+    switch (spec.kind) {
+    case WorldKind::Uniform:
+        generateUniform(world, rng, spec.landCount);
+        break;
+    case WorldKind::Towns:
+        generateTowns(world, rng, spec.landCount);
+        break;
+    case WorldKind::Nested:
+        generateNested(world, rng, spec.landCount);
+        break;
+    case WorldKind::Huge:
+        generateHuge(world, rng, spec.landCount);
+        break;
+    }
+
+    // 子领地与父领地同属一名玩家，20% 的领地带一名成员
+    std::uniform_int_distribution<uint32_t> player{0, std::max(spec.players, 1u) - 1};
+    for (auto& land : world.lands) {
+        land.owner = land.parentId >= 0 ? world.lands[static_cast<size_t>(land.parentId)].owner : playerUuid(player(rng));
+        if (std::bernoulli_distribution{0.2}(rng)) {
+            land.members.push_back(playerUuid(player(rng)));
+        }
+    }
+    return world;
+}
+
+BlockPos randomQueryPos(GeneratedWorld const& world, std::mt19937& rng, double inLandRatio) {
+    if (!world.lands.empty() && std::bernoulli_distribution{inLandRatio}(rng)) {
+        auto const& range = world.lands[uniform(rng, 0, static_cast<int>(world.lands.size()) - 1)].range;
+        return BlockPos{
+            uniform(rng, range.min.x, range.max.x),
+            uniform(rng, range.min.y, range.max.y),
+            uniform(rng, range.min.z, range.max.z)
+        };
+    }
+    return BlockPos{
+        uniform(rng, -world.extent, world.extent),
+        uniform(rng, WorldMinY, WorldMaxY),
+        uniform(rng, -world.extent, world.extent)
+    };
+}
+
+
+} // namespace bench
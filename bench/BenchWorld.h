@@ -0,0 +1,59 @@
+#pragma once
+#include "BenchRegistry.h"
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <vector>
+
+
+namespace bench {
+
+
+/**
+ * @brief 合成世界布局
+ */
+enum class WorldKind {
+    Uniform, // 均匀分布的中小型领地
+    Towns,   // 聚集在若干城镇中心附近的小型领地
+    Nested,  // 带多层子领地的父领地
+    Huge     // 少量超大管理员领地 + 均匀分布的普通领地
+};
+
+struct WorldSpec {
+    WorldKind kind{WorldKind::Uniform};
+    size_t    landCount{10000};
+    uint32_t  seed{42};
+    uint32_t  players{500}; // 领地主人/成员从 players 名玩家中抽取
+};
+
+/**
+ * @brief 生成的世界
+ * lands 按插入顺序排列(父领地先于子领地)，parentId 为 lands 中的下标，
+ * 依次插入 BenchRegistry 后与领地ID一致
+ */
+struct GeneratedWorld {
+    std::vector<BenchLand> lands;
+    int                    extent{0}; // 世界半径(方块)，领地位于 [-extent, extent]
+};
+
+[[nodiscard]] std::string_view         toString(WorldKind kind);
+[[nodiscard]] std::optional<WorldKind> parseWorldKind(std::string_view name);
+
+/**
+ * @brief 第 index 名合成玩家的 UUID
+ */
+[[nodiscard]] UUIDs playerUuid(uint32_t index);
+
+/**
+ * @brief 按种子确定性地生成世界
+ */
+[[nodiscard]] GeneratedWorld generateWorld(WorldSpec const& spec);
+
+/**
+ * @brief 生成查询坐标，inLandRatio 比例的坐标落在随机领地内，其余在世界范围内均匀分布
+ */
+[[nodiscard]] BlockPos randomQueryPos(GeneratedWorld const& world, std::mt19937& rng, double inLandRatio = 0.5);
+
+
+} // namespace bench
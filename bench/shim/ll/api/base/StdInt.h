@@ -0,0 +1,14 @@
+#pragma once
+// 基准测试替身: LeviLamina 整数类型别名
+#include <cstdint>
+
+using schar  = signed char;
+using uchar  = unsigned char;
+using ushort = unsigned short;
+using uint   = unsigned int;
+using ulong  = unsigned long;
+using llong  = long long;
+using ullong = unsigned long long;
+
+using int64  = std::int64_t;
+using uint64 = std::uint64_t;
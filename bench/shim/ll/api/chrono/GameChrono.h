@@ -0,0 +1,14 @@
+#pragma once
+// 基准测试替身: 游戏刻字面量
+#include <chrono>
+#include <cstdint>
+
+namespace ll::chrono {
+using ticks = std::chrono::duration<std::int64_t, std::ratio<1, 20>>;
+} // namespace ll::chrono
+
+namespace ll::inline literals::inline chrono_literals {
+constexpr ll::chrono::ticks operator""_tick(unsigned long long value) {
+    return ll::chrono::ticks{static_cast<std::int64_t>(value)};
+}
+} // namespace ll::inline literals::inline chrono_literals
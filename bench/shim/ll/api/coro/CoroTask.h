@@ -0,0 +1,2 @@
+#pragma once
+// 基准测试替身: 基准测试不使用协程
@@ -0,0 +1,29 @@
+#pragma once
+// 基准测试替身: 翻译直接返回原文
+#include "fmt/format.h"
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace ll::i18n {
+template <std::size_t N>
+struct FixedString {
+    char buf[N]{};
+
+    constexpr FixedString(char const (&str)[N]) { std::copy_n(str, N, buf); }
+
+    [[nodiscard]] constexpr std::string_view sv() const { return {buf, N - 1}; }
+};
+} // namespace ll::i18n
+
+#define LL_I18N_STRING_LITERAL_TYPE ::ll::i18n::FixedString
+
+namespace ll::inline literals::inline i18n_literals {
+template <LL_I18N_STRING_LITERAL_TYPE Fmt>
+[[nodiscard]] constexpr auto operator""_tr() {
+    return [=]<class... Args>(Args&&... args) -> std::string {
+        return fmt::vformat(Fmt.sv(), fmt::make_format_args(args...));
+    };
+}
+} // namespace ll::inline literals::inline i18n_literals
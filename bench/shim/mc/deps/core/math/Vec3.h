@@ -0,0 +1,7 @@
+#pragma once
+// 基准测试替身
+
+class Vec3 {
+public:
+    float x{0}, y{0}, z{0};
+};
@@ -0,0 +1,7 @@
+#pragma once
+// 基准测试替身
+#include "ll/api/base/StdInt.h"
+
+struct ActorUniqueID {
+    int64 rawID{-1};
+};
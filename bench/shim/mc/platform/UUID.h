@@ -0,0 +1,17 @@
+#pragma once
+// 基准测试替身: 仅保留 PLand 头文件引用到的接口
+#include "ll/api/base/StdInt.h"
+#include <string>
+
+namespace mce {
+class UUID {
+public:
+    uint64 a{0}, b{0};
+
+    [[nodiscard]] std::string asString() const { return std::to_string(a) + "-" + std::to_string(b); }
+
+    [[nodiscard]] static UUID fromString(std::string const&) { return {}; }
+
+    bool operator==(UUID const&) const = default;
+};
+} // namespace mce
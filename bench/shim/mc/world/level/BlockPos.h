@@ -0,0 +1,13 @@
+#pragma once
+// 基准测试替身
+#include "ll/api/base/StdInt.h"
+
+class BlockPos {
+public:
+    int x{0}, y{0}, z{0};
+
+    constexpr BlockPos() = default;
+    constexpr BlockPos(int x, int y, int z) : x(x), y(y), z(z) {}
+
+    constexpr bool operator==(BlockPos const&) const = default;
+};
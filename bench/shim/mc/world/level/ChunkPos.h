@@ -0,0 +1,18 @@
+#pragma once
+// 基准测试替身
+#include "ll/api/base/StdInt.h"
+#include <functional>
+
+class ChunkPos {
+public:
+    int x{0}, z{0};
+
+    constexpr bool operator==(ChunkPos const&) const = default;
+};
+
+template <>
+struct std::hash<ChunkPos> {
+    size_t operator()(ChunkPos const& pos) const noexcept {
+        return std::hash<uint64>{}((static_cast<uint64>(static_cast<uint>(pos.x)) << 32) | static_cast<uint>(pos.z));
+    }
+};
@@ -0,0 +1,28 @@
+-- 领地核心基准测试，不依赖 LeviLamina，可在 Linux / Windows 上直接构建运行
+-- xmake f -P bench -m release && xmake -P bench && xmake run -P bench PLandBench
+
+add_rules("mode.debug", "mode.release")
+set_defaultmode("release")
+
+add_requires("fmt 10.2.1")
+
+target("PLandBench")
+    set_kind("binary")
+    set_languages("c++23") -- std::expected(Global.h)
+    add_defines("LD_BENCH", "NOMINMAX")
+    add_includedirs("shim", "../src") -- shim 提供 PLand 头文件引用到的少量 mc / ll 类型
+    add_files("*.cc")
+    add_files(
+        "../src/pland/aabb/LandAABB.cc",
+        "../src/pland/aabb/LandPos.cc",
+        "../src/pland/land/LandDimensionChunkMap.cc",
+        "../src/pland/land/LandJournal.cc"
+    )
+    add_packages("fmt")
+
+    if is_plat("windows") then
+        add_cxflags("/utf-8", "/W4")
+    else
+        add_cxflags("-Wall", "-Wextra")
+        add_syslinks("pthread") -- LandJournal 的提交线程
+    end
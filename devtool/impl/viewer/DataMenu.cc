@@ -1,9 +1,13 @@
 #include "DataMenu.h"
 
 #include "internals/LandCacheViewer.h"
+#include "internals/MemoryViewer.h"
 
 namespace devtool {
 
-DataMenu::DataMenu() : IMenu("数据") { this->registerElement<internals::LandCacheViewer>(); }
+DataMenu::DataMenu() : IMenu("数据") {
+    this->registerElement<internals::LandCacheViewer>();
+    this->registerElement<internals::MemoryViewer>();
+}
 
 } // namespace devtool
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "MemoryViewer.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
+#include "pland/infra/MemoryReport.h"
+#include "pland/infra/StartupProfiler.h"
+
+#include <imgui.h>
+#include <string>
+
+namespace devtool::internals {
+
+// MemoryViewer
+MemoryViewer::MemoryViewer() : IMenuElement("内存占用") { window_ = std::make_unique<MemoryViewerWindow>(); }
+
+bool* MemoryViewer::getSelectFlag() { return window_->getOpenFlag(); }
+
+bool MemoryViewer::isSelected() const { return window_->isOpen(); }
+
+void MemoryViewer::tick() { window_->tick(); }
+
+
+// MemoryViewerWindow
+MemoryViewerWindow::MemoryViewerWindow() : snapshot_(std::make_shared<Snapshot>()) {}
+
+void MemoryViewerWindow::requestRefresh() {
+    {
+        std::lock_guard lock(snapshot_->mutex);
+        if (snapshot_->pending) {
+            return;
+        }
+        snapshot_->pending = true;
+    }
+    // 绘制句柄与选区只能在服务器线程访问
+    ll::thread::ServerThreadExecutor::getDefault().execute([snapshot = snapshot_]() {
+        auto usages = land::MemoryReport::collect();
+
+        std::lock_guard lock(snapshot->mutex);
+        snapshot->usages  = std::move(usages);
+        snapshot->time    = std::chrono::system_clock::now();
+        snapshot->pending = false;
+    });
+}
+
+void MemoryViewerWindow::render() {
+    if (!ImGui::Begin("内存占用", getOpenFlag())) {
+        ImGui::End();
+        return;
+    }
+
+    std::vector<land::MemoryUsage> usages;
+    bool                           pending;
+    bool                           empty;
+    {
+        std::lock_guard lock(snapshot_->mutex);
+        usages  = snapshot_->usages;
+        pending = snapshot_->pending;
+        empty   = snapshot_->time == std::chrono::system_clock::time_point{};
+    }
+    if (empty && !pending) {
+        requestRefresh(); // 首次打开时采集
+    }
+
+    ImGui::BeginDisabled(pending);
+    if (ImGui::Button("刷新")) {
+        requestRefresh();
+    }
+    ImGui::EndDisabled();
+    if (ImGui::IsItemHovered()) ImGui::SetItemTooltip("估算值，按 MSVC STL 的容器布局计算");
+
+    ImGui::Dummy(ImVec2(0, 5)); // 5像素上间距
+    ImGui::Separator();
+    ImGui::Dummy(ImVec2(0, 5)); // 5像素下间距
+
+    static ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+    if (ImGui::BeginTable("memory_usage", 3, flags)) {
+        ImGui::TableSetupColumn("结构", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("数量", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("内存", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableHeadersRow();
+
+        size_t total = 0;
+        for (auto const& usage : usages) {
+            total += usage.bytes;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", usage.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", usage.count);
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", land::mem_utils::formatBytes(usage.bytes).c_str());
+        }
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("合计(估算)");
+        ImGui::TableNextColumn();
+        ImGui::TableNextColumn();
+        ImGui::Text("%s", land::mem_utils::formatBytes(total).c_str());
+        ImGui::EndTable();
+    }
+
+    if (auto process = land::StartupProfiler::getProcessMemory(); process > 0) {
+        ImGui::Text("进程私有内存: %s", land::mem_utils::formatBytes(static_cast<size_t>(process)).c_str());
+    }
+    ImGui::End();
+}
+
+
+} // namespace devtool::internals
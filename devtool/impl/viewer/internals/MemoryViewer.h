@@ -0,0 +1,41 @@
+#pragma once
+#include "components/IComponent.h"
+#include "pland/utils/MemoryEstimate.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace devtool::internals {
+
+class MemoryViewerWindow final : public IWindow {
+    struct Snapshot {
+        std::mutex                            mutex;
+        std::vector<land::MemoryUsage>        usages;
+        std::chrono::system_clock::time_point time{};
+        bool                                  pending{false};
+    };
+    std::shared_ptr<Snapshot> snapshot_; // 与服务器线程的采集任务共享
+
+public:
+    explicit MemoryViewerWindow();
+
+    void requestRefresh(); // 在服务器线程采集
+
+    void render() override;
+};
+
+class MemoryViewer final : public IMenuElement {
+    std::unique_ptr<MemoryViewerWindow> window_;
+
+public:
+    explicit MemoryViewer();
+
+    bool* getSelectFlag() override;
+    bool  isSelected() const override;
+
+    void tick() override;
+};
+
+
+} // namespace devtool::internals
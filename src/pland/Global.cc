@@ -2,33 +2,112 @@
 #include "mc/world/actor/player/Player.h"
 #include "pland/PLand.h"
 #include "pland/land/LandRegistry.h"
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <utility>
 
 
 namespace land {
 
-std::unordered_map<std::string, std::string> GlobalPlayerLocaleCodeCached;
+std::unordered_map<UUIDm, PlayerLocale> GlobalPlayerLocaleCodeCached;
 
-std::string GetPlayerLocaleCodeFromSettings(Player& player) {
-    auto uuid = player.getUuid().asString();
-    auto iter = GlobalPlayerLocaleCodeCached.find(uuid);
+PlayerLocale const& GetPlayerLocaleFromSettings(Player& player) {
+    auto const& uuid = player.getUuid();
+    auto        iter = GlobalPlayerLocaleCodeCached.find(uuid);
     if (iter != GlobalPlayerLocaleCodeCached.end()) {
         return iter->second; // 命中缓存
     }
 
-    if (auto set = PLand::getInstance().getLandRegistry()->getPlayerSettings(uuid); set) {
+    std::string code;
+    if (auto set = PLand::getInstance().getLandRegistry()->getPlayerSettings(uuid.asString()); set) {
         if (set->localeCode == PlayerSettings::SYSTEM_LOCALE_CODE()) {
-            GlobalPlayerLocaleCodeCached[uuid] = player.getLocaleCode();
+            code = player.getLocaleCode();
         } else if (set->localeCode == PlayerSettings::SERVER_LOCALE_CODE()) {
-            GlobalPlayerLocaleCodeCached[uuid] = std::string(ll::i18n::getDefaultLocaleCode());
+            code = std::string(ll::i18n::getDefaultLocaleCode());
         } else {
-            GlobalPlayerLocaleCodeCached[uuid] = set->localeCode;
+            code = set->localeCode;
         }
     } else {
-        GlobalPlayerLocaleCodeCached[uuid] = std::string(ll::i18n::getDefaultLocaleCode());
+        code = std::string(ll::i18n::getDefaultLocaleCode());
     }
 
-    return GlobalPlayerLocaleCodeCached[uuid];
+    auto index = TrfTranslationTable::getInstance().resolveLocale(code);
+    return GlobalPlayerLocaleCodeCached.emplace(uuid, PlayerLocale{std::move(code), index}).first->second;
 }
 
-} // namespace land
\ No newline at end of file
+std::string GetPlayerLocaleCodeFromSettings(Player& player) { return GetPlayerLocaleFromSettings(player).code; }
+
+
+
+TrfTranslationTable::TrfTranslationTable() = default;
+
+TrfTranslationTable& TrfTranslationTable::getInstance() {
+    static TrfTranslationTable instance;
+    return instance;
+}
+
+TrfTranslationTable::Slot TrfTranslationTable::registerLiteral(std::string_view fmt) {
+    std::lock_guard lock(mMutex);
+    mLiterals.push_back(fmt);
+    return mLiterals.size() - 1;
+}
+
+void TrfTranslationTable::build(std::vector<std::string> const& localeCodes) {
+    std::lock_guard lock(mMutex);
+    for (auto const& code : localeCodes) {
+        (void)_resolveLocale(code);
+    }
+}
+
+TrfTranslationTable::LocaleIndex TrfTranslationTable::resolveLocale(std::string_view localeCode) {
+    std::lock_guard lock(mMutex);
+    return _resolveLocale(localeCode);
+}
+
+std::string_view TrfTranslationTable::get(Slot slot, LocaleIndex locale) const {
+    if (locale < mLocaleCount.load(std::memory_order_acquire)) {
+        auto const& entries = mLocales[locale]->entries;
+        if (slot < entries.size()) {
+            return entries[slot];
+        }
+    }
+    return slot < mLiterals.size() ? mLiterals[slot] : std::string_view{}; // 表构建后注册的字面量
+}
+
+std::string_view TrfTranslationTable::get(Slot slot, std::string_view localeCode) {
+    return get(slot, resolveLocale(localeCode));
+}
+
+std::size_t TrfTranslationTable::getLiteralCount() const {
+    std::lock_guard lock(mMutex);
+    return mLiterals.size();
+}
+
+TrfTranslationTable::LocaleIndex TrfTranslationTable::_resolveLocale(std::string_view localeCode) {
+    auto const count = mLocaleCount.load(std::memory_order_relaxed);
+    for (LocaleIndex i = 0; i < count; ++i) {
+        if (mLocales[i]->code == localeCode) {
+            return i;
+        }
+    }
+    if (count >= MaxLocales) {
+        return 0;
+    }
+
+    auto  table = std::make_unique<LocaleTable>();
+    auto& i18n  = ll::i18n::getInstance();
+    table->code = std::string(localeCode);
+    table->entries.reserve(mLiterals.size());
+    for (auto const& literal : mLiterals) {
+        table->entries.emplace_back(i18n.get(literal, localeCode));
+    }
+
+    // 先写入表再发布数量，读者按 acquire 读取数量后即可无锁访问
+    mLocales[count] = std::move(table);
+    mLocaleCount.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+} // namespace land
@@ -4,16 +4,25 @@
 #include "ll/api/i18n/I18n.h"
 #include "mc/legacy/ActorUniqueID.h"
 #include "mc/platform/UUID.h"
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <expected>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 class Player;
 
-#ifdef LDAPI_EXPORT
+#if defined(LD_BENCH)
+#define LDAPI // 基准测试直接静态编译源文件
+#elif defined(LDAPI_EXPORT)
 #define LDAPI __declspec(dllexport)
 #else
 #define LDAPI __declspec(dllimport)
@@ -48,10 +57,6 @@ enum class LandPermType : int {
     Guest,        // 访客
 };
 
-extern std::unordered_map<std::string, std::string> GlobalPlayerLocaleCodeCached;
-LDNDAPI extern std::string                          GetPlayerLocaleCodeFromSettings(Player& player
-                         ); // PLand::getInstance().getLandRegistry()->getPlayerLocaleCode
-
 
 inline int constexpr GlobalSubLandMaxNestedLevel = 16; // 子领地最大嵌套层数
 
@@ -59,10 +64,95 @@ inline int constexpr GlobalSubLandMaxNestedLevel = 16; // 子领地最大嵌套
 template <typename T, typename E = std::string>
 using Result = std::expected<T, E>;
 
+
+/**
+ * @brief _trf 预解析翻译表
+ * 每个 _trf 字面量在模块加载时注册并分配一个槽位，语言文件加载后按语言预解析为密集数组，
+ * 翻译查询由字符串键查找变为数组索引
+ *
+ * 语言表发布后不再修改也不会被移除，玩家的语言在首次使用时解析为语言索引并缓存，
+ * 之后的查询只是无锁的数组索引
+ */
+class TrfTranslationTable final {
+public:
+    using Slot        = std::size_t;
+    using LocaleIndex = std::size_t;
+
+    static constexpr std::size_t MaxLocales = 64; // 超出时回退到第一个语言(服务器默认语言)
+
+    LD_DISALLOW_COPY_AND_MOVE(TrfTranslationTable);
+
+    LDNDAPI static TrfTranslationTable& getInstance();
+
+    /**
+     * @brief 注册一个格式字面量，返回其槽位(由 TrfSlot 在静态初始化阶段调用)
+     * @note 语言表构建后注册的字面量不会进入已发布的表，查询时回退为原文
+     */
+    LDNDAPI Slot registerLiteral(std::string_view fmt);
+
+    /**
+     * @brief 预解析给定语言的翻译表 (语言文件加载后、首次查询前调用)
+     * @note 已发布的语言表保持不变，只追加缺失的语言
+     */
+    LDAPI void build(std::vector<std::string> const& localeCodes);
+
+    /**
+     * @brief 将语言代码解析为语言索引
+     * @note 未预解析的语言会在此时构建并发布，结果应由调用方缓存
+     */
+    LDNDAPI LocaleIndex resolveLocale(std::string_view localeCode);
+
+    /**
+     * @brief 获取槽位在指定语言下的翻译(无锁)
+     */
+    LDNDAPI std::string_view get(Slot slot, LocaleIndex locale) const;
+
+    /**
+     * @brief 获取槽位在指定语言下的翻译
+     */
+    LDNDAPI std::string_view get(Slot slot, std::string_view localeCode);
+
+    LDNDAPI std::size_t getLiteralCount() const;
+
+private:
+    struct LocaleTable {
+        std::string              code;
+        std::vector<std::string> entries; // 槽位 => 译文，发布后只读
+    };
+
+    explicit TrfTranslationTable();
+
+    LocaleIndex _resolveLocale(std::string_view localeCode); // 需持有 mMutex
+
+    std::vector<std::string_view>                              mLiterals;       // 槽位 => 格式字面量(静态初始化后只读)
+    std::array<std::unique_ptr<LocaleTable const>, MaxLocales> mLocales;        // 语言索引 => 语言表
+    std::atomic<std::size_t>                                   mLocaleCount{0}; // 已发布的语言数量
+    mutable std::mutex                                         mMutex;          // 保护字面量注册与语言表的发布
+};
+
+
+/**
+ * @brief 玩家语言缓存
+ */
+struct PlayerLocale {
+    std::string                      code;  // 语言代码
+    TrfTranslationTable::LocaleIndex index; // TrfTranslationTable 中的语言索引
+};
+
+extern std::unordered_map<UUIDm, PlayerLocale> GlobalPlayerLocaleCodeCached; // 玩家 => 语言(设置修改后需移除)
+
+LDNDAPI extern PlayerLocale const& GetPlayerLocaleFromSettings(Player& player
+); // PLand::getInstance().getLandRegistry()->getPlayerSettings
+LDNDAPI extern std::string GetPlayerLocaleCodeFromSettings(Player& player);
+
+template <LL_I18N_STRING_LITERAL_TYPE Fmt>
+inline TrfTranslationTable::Slot const TrfSlot = TrfTranslationTable::getInstance().registerLiteral(Fmt.sv());
+
 } // namespace land
 
 
-// ""_trf(Player) => GetPlayerLocaleCodeFromSettings => LandRegistry::getPlayerSettings
+// ""_trf(Player) => GetPlayerLocaleFromSettings => LandRegistry::getPlayerSettings (首次)
+// ""_trf(Player) => TrfSlot<Fmt> + PlayerLocale::index => TrfTranslationTable::get
 namespace ll::inline literals::inline i18n_literals {
 template <LL_I18N_STRING_LITERAL_TYPE Fmt>
 [[nodiscard]] constexpr auto operator""_trf() {
@@ -72,7 +162,10 @@ template <LL_I18N_STRING_LITERAL_TYPE Fmt>
     return [=]<class... Args>(Player& player, Args&&... args) {
         [[maybe_unused]] static constexpr auto checker = fmt::format_string<Args...>(Fmt.sv());
         return fmt::vformat(
-            i18n::getInstance().get(Fmt.sv(), land::GetPlayerLocaleCodeFromSettings(player)),
+            land::TrfTranslationTable::getInstance().get(
+                land::TrfSlot<Fmt>,
+                land::GetPlayerLocaleFromSettings(player).index
+            ),
             fmt::make_format_args(args...)
         );
     };
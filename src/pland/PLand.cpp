@@ -1,6 +1,10 @@
 #include "pland/PLand.h"
 
+#include <filesystem>
 #include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
 
 #include "ll/api/i18n/I18n.h"
 #include "ll/api/mod/RegisterHelper.h"
@@ -14,6 +18,7 @@
 #include "pland/hooks/EventListener.h"
 #include "pland/infra/Config.h"
 #include "pland/infra/DrawHandleManager.h"
+#include "pland/infra/StartupProfiler.h"
 #include "pland/land/LandRegistry.h"
 #include "pland/land/LandScheduler.h"
 #include "pland/selector/SelectorManager.h"
@@ -54,16 +59,44 @@ bool PLand::load() {
         logger.info("Version: {}", PLAND_VERSION_STRING);
     }
 
-    if (auto res = ll::i18n::getInstance().load(getSelf().getLangDir()); !res) {
-        logger.error("Load language file failed, plugin will use default language.");
-        res.error().log(logger);
-    }
+    auto& profiler  = StartupProfiler::getInstance();
+    auto  loadPhase = profiler.phase("load");
 
-    land::Config::tryLoad();
-    logger.setLevel(land::Config::cfg.logLevel);
+    {
+        auto phase = profiler.phase("I18n");
+        if (auto res = ll::i18n::getInstance().load(getSelf().getLangDir()); !res) {
+            logger.error("Load language file failed, plugin will use default language.");
+            res.error().log(logger);
+        }
+    }
+    {
+        auto phase = profiler.phase("Trf translation table");
+        // 预解析 _trf 翻译表
+        std::vector<std::string> localeCodes{std::string(ll::i18n::getDefaultLocaleCode())};
+        std::error_code          ec;
+        for (auto const& file : std::filesystem::directory_iterator(getSelf().getLangDir(), ec)) {
+            if (file.path().extension() == ".json") {
+                localeCodes.push_back(file.path().stem().string());
+            }
+        }
+        auto& table = land::TrfTranslationTable::getInstance();
+        table.build(localeCodes);
+        logger.debug("Pre-resolved {} _trf literals for {} locales", table.getLiteralCount(), localeCodes.size());
+    }
 
-    this->mLandRegistry = std::make_unique<land::LandRegistry>();
-    land::EconomySystem::getInstance().initEconomySystem();
+    {
+        auto phase = profiler.phase("Config");
+        land::Config::tryLoad();
+        logger.setLevel(land::Config::cfg.logLevel);
+    }
+    {
+        auto phase          = profiler.phase("LandRegistry");
+        this->mLandRegistry = std::make_unique<land::LandRegistry>();
+    }
+    {
+        auto phase = profiler.phase("Economy system");
+        land::EconomySystem::getInstance().initEconomySystem();
+    }
 
 #ifdef DEBUG
     logger.warn("Debug Mode");
@@ -74,13 +107,37 @@ bool PLand::load() {
 }
 
 bool PLand::enable() {
-    land::LandCommand::setup();
+    auto& profiler    = StartupProfiler::getInstance();
+    auto  enablePhase = profiler.phase("enable");
 
-    this->mLandScheduler     = std::make_unique<land::LandScheduler>();
-    this->mEventListener     = std::make_unique<land::EventListener>();
-    this->mSafeTeleport      = std::make_unique<land::SafeTeleport>();
-    this->mSelectorManager   = std::make_unique<land::SelectorManager>();
-    this->mDrawHandleManager = std::make_unique<land::DrawHandleManager>();
+    {
+        auto phase = profiler.phase("Commands");
+        land::LandCommand::setup();
+    }
+    {
+        auto phase           = profiler.phase("Economy ledger");
+        this->mEconomyLedger = std::make_unique<land::EconomyLedger>();
+    }
+    {
+        auto phase           = profiler.phase("Land scheduler");
+        this->mLandScheduler = std::make_unique<land::LandScheduler>();
+    }
+    {
+        auto phase           = profiler.phase("Event listeners");
+        this->mEventListener = std::make_unique<land::EventListener>();
+    }
+    {
+        auto phase          = profiler.phase("Safe teleport");
+        this->mSafeTeleport = std::make_unique<land::SafeTeleport>();
+    }
+    {
+        auto phase             = profiler.phase("Selector manager");
+        this->mSelectorManager = std::make_unique<land::SelectorManager>();
+    }
+    {
+        auto phase               = profiler.phase("Draw handle manager");
+        this->mDrawHandleManager = std::make_unique<land::DrawHandleManager>();
+    }
 
 
 #ifdef LD_TEST
@@ -91,6 +148,8 @@ bool PLand::enable() {
     if (land::Config::cfg.internal.devTools) devtool::DevToolAppManager::getInstance().initApp();
 #endif
 
+    enablePhase.end();
+    profiler.finish(getSelf().getDataDir() / "startup_trace.json");
     return true;
 }
 
@@ -104,12 +163,14 @@ bool PLand::disable() {
     logger.trace("[Main thread] Saving land registry data...");
     mLandRegistry->save();
     logger.trace("[Main thread] Land registry data saved.");
+    mLandRegistry->writeStartupSnapshot();
 
     logger.trace("Destroying resources...");
     mLandScheduler.reset();
     mEventListener.reset();
     mSafeTeleport.reset();
     mSelectorManager.reset();
+    mEconomyLedger.reset();
     mLandRegistry.reset();
     mDrawHandleManager.reset();
 
@@ -144,6 +205,7 @@ LandScheduler*      PLand::getLandScheduler() const { return mLandScheduler.get(
 SelectorManager*    PLand::getSelectorManager() const { return mSelectorManager.get(); }
 LandRegistry*       PLand::getLandRegistry() const { return mLandRegistry.get(); }
 DrawHandleManager*  PLand::getDrawHandleManager() const { return mDrawHandleManager.get(); }
+EconomyLedger*      PLand::getEconomyLedger() const { return mEconomyLedger.get(); }
 
 
 } // namespace land
@@ -3,6 +3,7 @@
 
 #include "ll/api/mod/NativeMod.h"
 
+#include "pland/economy/EconomyLedger.h"
 #include "pland/hooks/EventListener.h"
 #include "pland/infra/DrawHandleManager.h"
 #include "pland/infra/SafeTeleport.h"
@@ -41,6 +42,7 @@ class PLand {
     LDNDAPI SelectorManager*   getSelectorManager() const;
     LDNDAPI LandRegistry*      getLandRegistry() const;
     LDNDAPI DrawHandleManager* getDrawHandleManager() const;
+    LDNDAPI EconomyLedger*     getEconomyLedger() const;
 
 private:
     ll::mod::NativeMod& mSelf;
@@ -51,6 +53,7 @@ class PLand {
     std::unique_ptr<SafeTeleport>      mSafeTeleport;
     std::unique_ptr<SelectorManager>   mSelectorManager;
     std::unique_ptr<DrawHandleManager> mDrawHandleManager;
+    std::unique_ptr<EconomyLedger>     mEconomyLedger;
 };
 
 } // namespace land
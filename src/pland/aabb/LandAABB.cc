@@ -70,12 +70,6 @@ std::vector<BlockPos> LandAABB::getBorder() const {
         border.emplace_back(max.x, min.y, z);
         border.emplace_back(max.x, max.y, z);
     }
-    for (int y = min.y; y <= max.y; ++y) {
-        border.emplace_back(min.x, y, min.z);
-        border.emplace_back(min.x, y, max.z);
-        border.emplace_back(max.x, y, min.z);
-        border.emplace_back(max.x, y, max.z);
-    }
     return border;
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 #include "pland/Global.h"
 #include "pland/aabb/LandPos.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace land {
 
@@ -0,0 +1,139 @@
+#pragma once
+#include "pland/aabb/LandAABB.h"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 静态 AABB 层次包围盒树(BVH)
+ * 一次性构建，按最长轴中位数递归划分，用于 O(log n) 查询与给定范围相交的条目
+ * @note 构建后只读，范围变化时重新构建
+ */
+template <typename T>
+class LandAABBTree {
+public:
+    using Item = std::pair<LandAABB, T>;
+
+    static constexpr uint32_t LeafSize = 4; // 叶子节点最多容纳的条目数
+
+    LandAABBTree() = default;
+    explicit LandAABBTree(std::vector<Item> items) { build(std::move(items)); }
+
+    void build(std::vector<Item> items) {
+        mItems = std::move(items);
+        mNodes.clear();
+        if (mItems.empty()) {
+            return;
+        }
+        mNodes.reserve(mItems.size() / LeafSize * 2 + 1);
+        mNodes.emplace_back(); // 根节点
+        _build(0, 0, static_cast<uint32_t>(mItems.size()));
+    }
+
+    [[nodiscard]] size_t size() const { return mItems.size(); }
+    [[nodiscard]] bool   empty() const { return mItems.empty(); }
+
+    /**
+     * @brief 节点与条目占用的堆内存(字节)
+     */
+    [[nodiscard]] size_t heapBytes() const {
+        return mNodes.capacity() * sizeof(Node) + mItems.capacity() * sizeof(Item);
+    }
+
+    /**
+     * @brief 遍历与 range 相交的条目
+     * @param fn bool(LandAABB const&, T const&)，返回 false 时停止遍历
+     * @return 是否遍历完成(未被 fn 中止)
+     */
+    template <typename Fn>
+    bool query(LandAABB const& range, Fn&& fn) const {
+        if (mNodes.empty()) {
+            return true;
+        }
+        uint32_t stack[64];
+        int      top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            auto const& node = mNodes[stack[--top]];
+            if (!LandAABB::isCollision(node.bounds, range)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    if (LandAABB::isCollision(mItems[i].first, range) && !fn(mItems[i].first, mItems[i].second)) {
+                        return false;
+                    }
+                }
+                continue;
+            }
+            stack[top++] = node.first;     // 左子节点
+            stack[top++] = node.first + 1; // 右子节点
+        }
+        return true;
+    }
+
+private:
+    struct Node {
+        LandAABB bounds;
+        uint32_t first{0}; // 叶子: 首个条目下标；内部节点: 左子节点下标(右子节点紧随其后)
+        uint32_t count{0}; // 叶子: 条目数量；内部节点: 0
+    };
+
+    void _build(uint32_t index, uint32_t begin, uint32_t end) {
+        LandAABB bounds = mItems[begin].first;
+        for (uint32_t i = begin + 1; i < end; ++i) {
+            auto const& aabb = mItems[i].first;
+            bounds.min.x     = std::min(bounds.min.x, aabb.min.x);
+            bounds.min.y     = std::min(bounds.min.y, aabb.min.y);
+            bounds.min.z     = std::min(bounds.min.z, aabb.min.z);
+            bounds.max.x     = std::max(bounds.max.x, aabb.max.x);
+            bounds.max.y     = std::max(bounds.max.y, aabb.max.y);
+            bounds.max.z     = std::max(bounds.max.z, aabb.max.z);
+        }
+        mNodes[index].bounds = bounds;
+
+        if (end - begin <= LeafSize) {
+            mNodes[index].first = begin;
+            mNodes[index].count = end - begin;
+            return;
+        }
+
+        // 沿最长轴按中心点中位数划分
+        int const dx   = bounds.max.x - bounds.min.x;
+        int const dy   = bounds.max.y - bounds.min.y;
+        int const dz   = bounds.max.z - bounds.min.z;
+        int const axis = dx >= dy && dx >= dz ? 0 : dy >= dz ? 1 : 2;
+
+        auto center = [axis](Item const& item) {
+            auto const& aabb = item.first;
+            return axis == 0 ? aabb.min.x + aabb.max.x : axis == 1 ? aabb.min.y + aabb.max.y : aabb.min.z + aabb.max.z;
+        };
+        uint32_t const mid = begin + (end - begin) / 2;
+        std::nth_element(
+            mItems.begin() + begin,
+            mItems.begin() + mid,
+            mItems.begin() + end,
+            [&](Item const& a, Item const& b) { return center(a) < center(b); }
+        );
+
+        // 左右子节点相邻存放
+        auto children = static_cast<uint32_t>(mNodes.size());
+        mNodes.emplace_back();
+        mNodes.emplace_back();
+        mNodes[index].first = children;
+
+        _build(children, begin, mid);
+        _build(children + 1, mid, end);
+    }
+
+    std::vector<Node> mNodes;
+    std::vector<Item> mItems;
+};
+
+
+} // namespace land
@@ -35,6 +35,9 @@
 #include "pland/infra/Config.h"
 #include "pland/infra/DataConverter.h"
 #include "pland/infra/DrawHandleManager.h"
+#include "pland/infra/MemoryReport.h"
+#include "pland/infra/SafeTeleport.h"
+#include "pland/infra/SpanTracer.h"
 #include "pland/infra/draw/IDrawHandle.h"
 #include "pland/land/LandRegistry.h"
 #include "pland/selector/SelectorManager.h"
@@ -42,6 +45,7 @@
 #include "pland/utils/McUtils.h"
 #include "pland/utils/Utils.h"
 #include <algorithm>
+#include <ctime>
 #include <filesystem>
 #include <ll/api/command/Command.h>
 #include <ll/api/command/CommandHandle.h>
@@ -402,8 +406,8 @@ static auto const SetLanguage = [](CommandOrigin const& ori, CommandOutput& out)
             settings = db.getPlayerSettings(uuid);
         }
 
-        settings->localeCode               = lang;
-        GlobalPlayerLocaleCodeCached[uuid] = lang;
+        settings->localeCode = lang;
+        GlobalPlayerLocaleCodeCached.erase(pl.getUuid()); // 下次使用时重新解析
         mc_utils::sendText<mc_utils::LogLevel::Info>(pl, "语言包已切换为: {}"_trf(pl, lang));
     });
 };
@@ -427,6 +431,61 @@ static auto const This = [](CommandOrigin const& ori, CommandOutput& out) {
     LandManagerGUI::sendMainMenu(player, land);
 };
 
+static auto const StatsTeleport = [](CommandOrigin const& ori, CommandOutput& out) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+
+    auto& logger = land::PLand::getInstance().getSelf().getLogger();
+    for (auto const& line : PLand::getInstance().getSafeTeleport()->getLatencyReport()) {
+        logger.info("[SafeTeleport] {}", line);
+    }
+};
+
+static auto const Mem = [](CommandOrigin const& ori, CommandOutput& out) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+
+    auto& logger = land::PLand::getInstance().getSelf().getLogger();
+    for (auto const& line : MemoryReport::format(MemoryReport::collect())) {
+        logger.info("[Memory] {}", line);
+    }
+};
+
+enum class TraceAction : int { Start, Stop };
+struct TraceParam {
+    TraceAction action;
+};
+static auto const Trace = [](CommandOrigin const& ori, CommandOutput& out, TraceParam const& param) {
+    CHECK_TYPE(ori, out, CommandOriginType::DedicatedServer);
+
+    if (param.action == TraceAction::Start) {
+        if (SpanTracer::start()) {
+            mc_utils::sendText(out, "已开始记录性能追踪，使用 /pland trace stop 停止并写出文件"_tr());
+        } else {
+            mc_utils::sendText<mc_utils::LogLevel::Error>(out, "性能追踪已在记录中"_tr());
+        }
+        return;
+    }
+
+    if (!SpanTracer::isRunning()) {
+        mc_utils::sendText<mc_utils::LogLevel::Error>(out, "性能追踪未开始"_tr());
+        return;
+    }
+    auto file = PLand::getInstance().getSelf().getDataDir() / "traces"
+              / fmt::format("trace_{}.json", static_cast<long long>(std::time(nullptr)));
+    if (auto summary = SpanTracer::stop(file)) {
+        mc_utils::sendText(
+            out,
+            "性能追踪已写出到 {}，共 {} 个 Span({} 个线程，{} 个被覆盖)"_tr(
+                file.string(),
+                summary->spans,
+                summary->threads,
+                summary->overwritten
+            )
+        );
+    } else {
+        mc_utils::sendText<mc_utils::LogLevel::Error>(out, "性能追踪文件写出失败"_tr());
+    }
+};
+
 }; // namespace Lambda
 
 
@@ -485,6 +544,17 @@ bool LandCommand::setup() {
     // pland set language 设置语言
     cmd.overload().text("set").text("language").execute(Lambda::SetLanguage);
 
+    // pland stats teleport 安全传送延迟统计(控制台)
+    cmd.overload().text("stats").text("teleport").execute(Lambda::StatsTeleport);
+
+    // pland mem 内存占用估算(控制台)
+    cmd.overload().text("mem").execute(Lambda::Mem);
+
+#ifdef LD_SPAN_TRACE
+    // pland trace <start|stop> 性能追踪(控制台)
+    cmd.overload<Lambda::TraceParam>().text("trace").required("action").execute(Lambda::Trace);
+#endif
+
 #ifdef LD_DEVTOOL
     // pland devtool
     if (Config::cfg.internal.devTools) {
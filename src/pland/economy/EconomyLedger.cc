@@ -0,0 +1,154 @@
+#include "pland/economy/EconomyLedger.h"
+#include "ll/api/service/Bedrock.h"
+#include "mc/world/actor/player/Player.h"
+#include "mc/world/level/Level.h"
+#include "pland/PLand.h"
+#include "pland/economy/EconomySystem.h"
+#include "pland/land/LandRegistry.h"
+#include "pland/utils/JSON.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+
+
+namespace land {
+
+
+EconomyLedger::EconomyLedger() { _load(); }
+EconomyLedger::~EconomyLedger() = default;
+
+std::string EconomyLedger::makeKey(std::string_view scope, LandID landId) {
+    return fmt::format("{}:{}", scope, landId);
+}
+
+EconomyLedger::Settlement EconomyLedger::credit(UUIDs const& uuid, llong amount, std::string key, std::string reason) {
+    return _submit(uuid, LedgerEntry{std::move(key), amount, std::move(reason)});
+}
+
+EconomyLedger::Settlement EconomyLedger::debit(UUIDs const& uuid, llong amount, std::string key, std::string reason) {
+    return _submit(uuid, LedgerEntry{std::move(key), -amount, std::move(reason)});
+}
+
+EconomyLedger::Settlement EconomyLedger::_submit(UUIDs const& uuid, LedgerEntry entry) {
+    auto& ledger = mLedgers[uuid];
+    if (std::ranges::find(ledger.applied, entry.key) != ledger.applied.end()
+        || std::ranges::any_of(ledger.pending, [&](LedgerEntry const& e) { return e.key == entry.key; })) {
+        return Settlement::Duplicate;
+    }
+    entry.createdAt =
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // 已有待结算条目时保持顺序，不插队
+    if (ledger.pending.empty()) {
+        auto player = ll::service::getLevel()->getPlayer(UUIDm::fromString(uuid));
+        if (player && _apply(*player, entry)) {
+            _markApplied(ledger, entry.key);
+            _persist(uuid); // 已结算的键需要落盘，否则重启后同一键会被再次结算
+            return Settlement::Applied;
+        }
+    }
+
+    land::PLand::getInstance().getSelf().getLogger().debug(
+        "[EconomyLedger] Queued {} for {} ({}, key: {})",
+        entry.amount,
+        uuid,
+        entry.reason,
+        entry.key
+    );
+    ledger.pending.push_back(std::move(entry));
+    _persist(uuid);
+    return Settlement::Queued;
+}
+
+bool EconomyLedger::_apply(Player& player, LedgerEntry const& entry) {
+    auto economy = EconomySystem::getInstance().getEconomyInterface();
+    return entry.amount >= 0 ? economy->add(player, entry.amount) : economy->tryReduce(player, -entry.amount);
+}
+
+void EconomyLedger::_markApplied(PlayerLedger& ledger, std::string const& key) {
+    ledger.applied.push_back(key);
+    if (ledger.applied.size() > AppliedKeyHistory) {
+        ledger.applied.erase(ledger.applied.begin());
+    }
+}
+
+size_t EconomyLedger::settle(Player& player) {
+    auto uuid = player.getUuid().asString();
+    auto iter = mLedgers.find(uuid);
+    if (iter == mLedgers.end() || iter->second.pending.empty()) {
+        return 0;
+    }
+
+    auto&  ledger  = iter->second;
+    auto&  logger  = land::PLand::getInstance().getSelf().getLogger();
+    size_t applied = 0;
+    while (!ledger.pending.empty()) {
+        auto const& entry = ledger.pending.front();
+        if (!_apply(player, entry)) {
+            // 按顺序结算，失败时后续条目也保留到下次，避免入账与扣款乱序
+            logger.warn(
+                "[EconomyLedger] Failed to settle {} for {} ({}, key: {}), {} entries will retry next time",
+                entry.amount,
+                player.getRealName(),
+                entry.reason,
+                entry.key,
+                ledger.pending.size()
+            );
+            break;
+        }
+        _markApplied(ledger, entry.key);
+        ledger.pending.erase(ledger.pending.begin());
+        ++applied;
+        _persist(uuid); // 每结算一条立即落盘，避免重复结算
+    }
+    return applied;
+}
+
+std::vector<LedgerEntry> EconomyLedger::getPending(UUIDs const& uuid) const {
+    auto iter = mLedgers.find(uuid);
+    return iter == mLedgers.end() ? std::vector<LedgerEntry>{} : iter->second.pending;
+}
+
+size_t EconomyLedger::getPendingCount() const {
+    size_t count = 0;
+    for (auto const& [uuid, ledger] : mLedgers) {
+        count += ledger.pending.size();
+    }
+    return count;
+}
+
+void EconomyLedger::_load() {
+    auto& db     = *PLand::getInstance().getLandRegistry()->mDB;
+    auto& logger = land::PLand::getInstance().getSelf().getLogger();
+
+    for (auto [key, value] : db.iter()) {
+        if (!key.starts_with(LandRegistry::DbEconomyLedgerKeyPrefix)) continue;
+
+        try {
+            PlayerLedger ledger;
+            auto         json = JSON::parse(value);
+            JSON::jsonToStructTryPatch(json, ledger);
+            auto uuid = key.substr(std::string_view{LandRegistry::DbEconomyLedgerKeyPrefix}.size());
+            mLedgers.emplace(std::string{uuid}, std::move(ledger));
+        } catch (std::exception const& e) {
+            logger.error("[EconomyLedger] Failed to load {}: {}", key, e.what());
+        }
+    }
+    logger.debug("[EconomyLedger] Loaded {} pending entries", getPendingCount());
+}
+
+void EconomyLedger::_persist(UUIDs const& uuid) {
+    auto& db  = *PLand::getInstance().getLandRegistry()->mDB;
+    auto  key = LandRegistry::DbEconomyLedgerKeyPrefix + uuid;
+
+    auto iter = mLedgers.find(uuid);
+    if (iter == mLedgers.end() || (iter->second.pending.empty() && iter->second.applied.empty())) {
+        db.del(key);
+        return;
+    }
+    db.set(key, JSON::stringify(JSON::structTojson(iter->second)));
+}
+
+
+} // namespace land
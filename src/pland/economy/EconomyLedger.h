@@ -0,0 +1,91 @@
+#pragma once
+#include "pland/Global.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+class Player;
+
+namespace land {
+
+
+/**
+ * @brief 经济账本条目
+ */
+struct LedgerEntry {
+    std::string key;          // 幂等键，同一键只会结算一次
+    llong       amount{0};    // 金额，正数为入账，负数为扣款
+    std::string reason;       // 原因(日志用)
+    llong       createdAt{0}; // 创建时间(unix 秒)
+};
+
+/**
+ * @brief 离线经济账本
+ * 玩家不在线或经济操作失败时，经济变动写入 PLand 数据库，玩家进服时按顺序批量结算，
+ * 领地操作本身不再因经济操作失败而回滚
+ * @note RAII 由 PLand 管理，仅在主线程使用
+ */
+class EconomyLedger final {
+public:
+    enum class Settlement {
+        Applied,  // 已立即结算
+        Queued,   // 已写入账本，待玩家上线后结算
+        Duplicate // 幂等键已存在，忽略
+    };
+
+    struct PlayerLedger {
+        std::vector<LedgerEntry> pending; // 待结算
+        std::vector<std::string> applied; // 最近已结算的幂等键
+    };
+
+    static constexpr size_t AppliedKeyHistory = 32; // 每位玩家保留的已结算幂等键数量
+
+    LD_DISALLOW_COPY_AND_MOVE(EconomyLedger);
+
+    LDAPI explicit EconomyLedger();
+    LDAPI ~EconomyLedger();
+
+    /**
+     * @brief 入账
+     */
+    LDAPI Settlement credit(UUIDs const& uuid, llong amount, std::string key, std::string reason = {});
+
+    /**
+     * @brief 扣款(余额不足时保留在账本中，下次上线重试)
+     */
+    LDAPI Settlement debit(UUIDs const& uuid, llong amount, std::string key, std::string reason = {});
+
+    /**
+     * @brief 结算玩家的待处理条目
+     * @return 本次结算的条目数量
+     */
+    LDAPI size_t settle(Player& player);
+
+    LDNDAPI std::vector<LedgerEntry> getPending(UUIDs const& uuid) const;
+
+    LDNDAPI size_t getPendingCount() const;
+
+    /**
+     * @brief 生成幂等键 <scope>:<landId>
+     * 领地ID不会被复用，同一领地的同一类操作(如删除退款)重试时得到相同的键
+     */
+    LDNDAPI static std::string makeKey(std::string_view scope, LandID landId);
+
+private:
+    Settlement _submit(UUIDs const& uuid, LedgerEntry entry);
+
+    static bool _apply(Player& player, LedgerEntry const& entry);
+
+    void _markApplied(PlayerLedger& ledger, std::string const& key);
+
+    void _load();
+    void _persist(UUIDs const& uuid);
+
+    std::unordered_map<UUIDs, PlayerLedger> mLedgers;
+};
+
+
+} // namespace land
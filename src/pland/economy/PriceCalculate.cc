@@ -1,13 +1,94 @@
 #include "pland/economy/PriceCalculate.h"
 #include "pland/aabb/LandAABB.h"
+#include "pland/infra/Config.h"
+#include "pland/land/Land.h"
 
 
 #pragma warning(disable : 4702)
 #include "exprtk.hpp"
 #pragma warning(default : 4702)
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 namespace land {
 
+namespace {
+
+// 公式中可用的变量，顺序即 CompiledFormula::mSlots 的下标
+constexpr std::array<std::string_view, 6> FormulaVariables{"height", "width", "depth", "square", "volume", "dimensionId"};
+
+/**
+ * @brief 预编译的价格公式
+ * 变量以引用方式绑定到 mSlots，求值时只需写入槽位，无需重新解析
+ */
+struct CompiledFormula {
+    std::array<double, FormulaVariables.size()> mSlots{};
+    exprtk::symbol_table<double>                 mSymbols;
+    exprtk::expression<double>                   mExpr;
+    bool                                         mValid{false};
+
+    explicit CompiledFormula(std::string const& code) {
+        for (size_t i = 0; i < FormulaVariables.size(); ++i) {
+            mSymbols.add_variable(std::string{FormulaVariables[i]}, mSlots[i]);
+        }
+        mSymbols.add_function("random_num", &internals::random_num);
+        mSymbols.add_function("random_num_range", &internals::random_num_range);
+        mExpr.register_symbol_table(mSymbols);
+
+        exprtk::parser<double> parser;
+        mValid = parser.compile(code, mExpr);
+    }
+
+    double value() const { return mValid ? mExpr.value() : 0; }
+
+    double value(LandAABB const& aabb, int dimensionId) {
+        mSlots = {
+            static_cast<double>(aabb.getHeight()),
+            static_cast<double>(aabb.getWidth()),
+            static_cast<double>(aabb.getDepth()),
+            static_cast<double>(aabb.getSquare()),
+            static_cast<double>(aabb.getVolume()),
+            static_cast<double>(dimensionId)
+        };
+        return value();
+    }
+};
+
+std::atomic<uint64> FormulaCacheGeneration{0}; // 配置重载时递增，使各线程的缓存失效
+
+/**
+ * @brief 获取公式的编译结果
+ * 每个线程持有独立的缓存(exprtk 表达式求值时会写入变量槽位，不能跨线程共享)
+ */
+CompiledFormula& getCompiledFormula(std::string const& code) {
+    static constexpr size_t MaxCachedFormulas = 64;
+
+    thread_local std::unordered_map<std::string, std::unique_ptr<CompiledFormula>> cache;
+    thread_local uint64                                                            generation{0};
+
+    if (auto current = FormulaCacheGeneration.load(std::memory_order_acquire); generation != current) {
+        cache.clear();
+        generation = current;
+    }
+
+    auto iter = cache.find(code);
+    if (iter == cache.end()) {
+        if (cache.size() >= MaxCachedFormulas) {
+            cache.clear();
+        }
+        iter = cache.emplace(code, std::make_unique<CompiledFormula>(code)).first;
+    }
+    return *iter->second;
+}
+
+} // namespace
+
 PriceCalculate::Variable::Variable() = default;
 PriceCalculate::Variable::Impl*       PriceCalculate::Variable::operator->() { return &mImpl; }
 PriceCalculate::Variable::Impl&       PriceCalculate::Variable::get() { return mImpl; }
@@ -42,6 +123,84 @@ PriceCalculate::Variable PriceCalculate::Variable::make(int height, int width, i
 
 
 double PriceCalculate::eval(string const& code, Variable const& variables) {
+    auto& formula = getCompiledFormula(code);
+
+    bool bound = true;
+    formula.mSlots.fill(0);
+    for (auto const& [key, value] : variables.get()) {
+        auto iter = std::find(FormulaVariables.begin(), FormulaVariables.end(), key);
+        if (iter == FormulaVariables.end()) {
+            bound = false; // 自定义变量，无法使用预编译的公式
+            break;
+        }
+        formula.mSlots[static_cast<size_t>(iter - FormulaVariables.begin())] = value;
+    }
+    if (bound) {
+        return formula.value();
+    }
+    return evalUncached(code, variables);
+}
+
+double PriceCalculate::eval(string const& code, LandAABB const& aabb, int dimensionId) {
+    return getCompiledFormula(code).value(aabb, dimensionId);
+}
+
+std::vector<double>
+PriceCalculate::evalBatch(string const& code, std::span<LandAABB const> ranges, std::span<int const> dimensionIds) {
+    std::vector<double> result(ranges.size(), 0);
+    if (dimensionIds.empty() || (dimensionIds.size() != 1 && dimensionIds.size() != ranges.size())) {
+        return result;
+    }
+    auto& formula = getCompiledFormula(code);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        result[i] = formula.value(ranges[i], dimensionIds[dimensionIds.size() == 1 ? 0 : i]);
+    }
+    return result;
+}
+
+std::vector<int> PriceCalculate::appraise(std::span<std::shared_ptr<Land> const> lands) {
+    auto const& bought = Config::cfg.land.bought;
+
+    // 与购买时一致: 子领地使用子领地公式，其余按 3D / 2D 区分
+    std::array<string const*, 3> const codes{
+        &Config::cfg.land.subLand.calculate,
+        &bought.threeDimensionl.calculate,
+        &bought.twoDimensionl.calculate
+    };
+    auto formulaIndex = [](Land const& land) -> size_t { return land.hasParentLand() ? 0 : land.is3D() ? 1 : 2; };
+
+    std::vector<int> result(lands.size(), 0);
+
+    std::vector<LandAABB> ranges;
+    std::vector<int>      dimensionIds;
+    std::vector<size_t>   indices; // 组内下标 => lands 下标
+    for (size_t group = 0; group < codes.size(); ++group) {
+        ranges.clear();
+        dimensionIds.clear();
+        indices.clear();
+        for (size_t i = 0; i < lands.size(); ++i) {
+            if (!lands[i] || formulaIndex(*lands[i]) != group) continue;
+            ranges.push_back(lands[i]->getAABB());
+            dimensionIds.push_back(lands[i]->getDimensionId());
+            indices.push_back(i);
+        }
+        if (ranges.empty()) continue;
+
+        auto prices = evalBatch(*codes[group], ranges, dimensionIds);
+        for (size_t j = 0; j < prices.size(); ++j) {
+            auto iter = bought.dimensionPriceCoefficients.find(std::to_string(dimensionIds[j]));
+            if (iter != bought.dimensionPriceCoefficients.end()) {
+                prices[j] *= iter->second;
+            }
+            result[indices[j]] = calculateDiscountPrice(prices[j], Config::cfg.land.discountRate);
+        }
+    }
+    return result;
+}
+
+void PriceCalculate::invalidateCache() { FormulaCacheGeneration.fetch_add(1, std::memory_order_release); }
+
+double PriceCalculate::evalUncached(string const& code, Variable const& variables) {
     exprtk::symbol_table<double> symbols;
 
     for (auto const& [key, value] : variables.get()) {
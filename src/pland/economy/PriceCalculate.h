@@ -1,10 +1,15 @@
 #pragma once
 #include "pland/Global.h"
 #include "pland/aabb/LandAABB.h"
+#include <memory>
+#include <span>
 #include <unordered_map>
+#include <vector>
 
 namespace land {
 
+class Land;
+
 
 /**
  * @brief 价格计算类
@@ -13,6 +18,9 @@ class PriceCalculate {
 public:
     PriceCalculate() = delete;
 
+private:
+    static double evalUncached(std::string const& code, Variable const& variables);
+
 public:
     struct Variable {
         using Impl = std::unordered_map<std::string, double>;
@@ -36,9 +44,36 @@ class PriceCalculate {
 public:
     /**
      * @brief 计算价格
+     * @note 公式按文本缓存编译结果，仅包含内置变量时复用预编译的表达式
      */
     LDNDAPI static double eval(std::string const& code, Variable const& variables);
 
+    /**
+     * @brief 计算价格(直接绑定领地范围，无需构造 Variable)
+     */
+    LDNDAPI static double eval(std::string const& code, LandAABB const& aabb, int dimensionId);
+
+    /**
+     * @brief 批量计算价格
+     * 公式只查找一次，依次写入各领地范围的变量槽位求值
+     * @param dimensionIds 与 ranges 一一对应，或只有一个(全部范围共用)
+     * @return 与 ranges 一一对应的价格
+     */
+    LDNDAPI static std::vector<double>
+    evalBatch(std::string const& code, std::span<LandAABB const> ranges, std::span<int const> dimensionIds);
+
+    /**
+     * @brief 按当前配置估算领地价格(购买公式、维度价格系数与折扣)
+     * 领地按所用公式分组，每组调用一次 evalBatch；可用于管理员领地列表或子领地树的整体估价
+     * @return 与 lands 一一对应的价格
+     */
+    LDNDAPI static std::vector<int> appraise(std::span<std::shared_ptr<Land> const> lands);
+
+    /**
+     * @brief 使已编译的公式缓存失效(配置重载时调用)
+     */
+    LDAPI static void invalidateCache();
+
     /**
      * @brief 计算折扣价
      */
@@ -21,5 +21,8 @@ bool EmtpyInterface::reduce(mce::UUID const&, llong) const { return true; }
 bool EmtpyInterface::transfer(Player&, Player&, llong) const { return true; }
 bool EmtpyInterface::transfer(mce::UUID const&, mce::UUID const&, llong) const { return true; }
 
+bool EmtpyInterface::tryReduce(Player&, llong) const { return true; }
+bool EmtpyInterface::tryReduce(mce::UUID const&, llong) const { return true; }
+
 
 } // namespace land::internals
\ No newline at end of file
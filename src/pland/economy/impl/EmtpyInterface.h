@@ -27,6 +27,9 @@ class EmtpyInterface final : public IEconomyInterface {
 
     LDNDAPI bool transfer(Player& from, Player& to, llong amount) const override;
     LDNDAPI bool transfer(mce::UUID const& from, mce::UUID const& to, llong amount) const override;
+
+    LDNDAPI bool tryReduce(Player& player, llong amount) const override;
+    LDNDAPI bool tryReduce(mce::UUID const& uuid, llong amount) const override;
 };
 
 
@@ -14,6 +14,13 @@ IEconomyInterface::IEconomyInterface() = default;
 bool IEconomyInterface::has(Player& player, llong amount) const { return get(player) >= amount; }
 bool IEconomyInterface::has(mce::UUID const& uuid, llong amount) const { return get(uuid) >= amount; }
 
+bool IEconomyInterface::tryReduce(Player& player, llong amount) const {
+    return has(player, amount) && reduce(player, amount);
+}
+bool IEconomyInterface::tryReduce(mce::UUID const& uuid, llong amount) const {
+    return has(uuid, amount) && reduce(uuid, amount);
+}
+
 std::string IEconomyInterface::getCostMessage(Player& player, long long amount) const {
     auto& config = getConfig();
     if (!config.enabled) {
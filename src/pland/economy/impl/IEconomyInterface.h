@@ -32,6 +32,12 @@ class IEconomyInterface {
     LDNDAPI virtual bool has(Player& player, llong amount) const;
     LDNDAPI virtual bool has(mce::UUID const& uuid, llong amount) const;
 
+    /**
+     * @brief 检查余额并扣除(余额不足时不扣除)
+     */
+    LDNDAPI virtual bool tryReduce(Player& player, llong amount) const;
+    LDNDAPI virtual bool tryReduce(mce::UUID const& uuid, llong amount) const;
+
 public:
     LDNDAPI virtual std::string getCostMessage(Player& player, llong amount) const;
 
@@ -16,25 +16,41 @@ namespace land::internals {
 
 ScoreBoardInterface::ScoreBoardInterface() = default;
 
-llong ScoreBoardInterface::get(Player& player) const {
+Objective* ScoreBoardInterface::_resolveObjective() const {
     auto& cfg = getConfig();
 
-    Scoreboard& scoreboard = ll::service::getLevel()->getScoreboard();
-    Objective*  obj        = scoreboard.getObjective(cfg.scoreboardName);
+    Objective* obj = ll::service::getLevel()->getScoreboard().getObjective(cfg.scoreboardName);
     if (!obj) {
         land::PLand::getInstance().getSelf().getLogger().error(
             "[ScoreBoardInterface] Could not find scoreboard: {}",
             cfg.scoreboardName
         );
-        return 0;
     }
+    return obj;
+}
 
+ScoreboardId const& ScoreBoardInterface::_resolveId(Scoreboard& scoreboard, Player& player) {
     ScoreboardId const& id = scoreboard.getScoreboardId(player);
     if (id.mRawID == ScoreboardId::INVALID().mRawID) {
-        scoreboard.createScoreboardId(player);
+        return scoreboard.createScoreboardId(player);
     }
+    return id;
+}
+
+bool ScoreBoardInterface::_modify(Player& player, Objective& obj, llong amount, PlayerScoreSetFunction action) {
+    Scoreboard& scoreboard = ll::service::getLevel()->getScoreboard();
+
+    ScoreboardOperationResult result;
+    scoreboard.modifyPlayerScore(result, _resolveId(scoreboard, player), obj, static_cast<int>(amount), action);
+    return result == ScoreboardOperationResult::Success;
+}
 
-    return obj->getPlayerScore(id).mValue;
+llong ScoreBoardInterface::get(Player& player) const {
+    Objective* obj = _resolveObjective();
+    if (!obj) {
+        return 0;
+    }
+    return obj->getPlayerScore(_resolveId(ll::service::getLevel()->getScoreboard(), player)).mValue;
 }
 llong ScoreBoardInterface::get(mce::UUID const& uuid) const {
     auto player = ll::service::getLevel()->getPlayer(uuid);
@@ -48,24 +64,8 @@ llong ScoreBoardInterface::get(mce::UUID const& uuid) const {
 }
 
 bool ScoreBoardInterface::set(Player& player, llong amount) const {
-    auto& cfg = getConfig();
-
-    Scoreboard& scoreboard = ll::service::getLevel()->getScoreboard();
-    Objective*  obj        = scoreboard.getObjective(cfg.scoreboardName);
-    if (!obj) {
-        land::PLand::getInstance().getSelf().getLogger().error(
-            "[ScoreBoardInterface] Could not find scoreboard: {}",
-            cfg.scoreboardName
-        );
-        return false;
-    }
-    const ScoreboardId& id = scoreboard.getScoreboardId(player);
-    if (id.mRawID == ScoreboardId::INVALID().mRawID) {
-        scoreboard.createScoreboardId(player);
-    }
-    ScoreboardOperationResult result;
-    scoreboard.modifyPlayerScore(result, id, *obj, static_cast<int>(amount), PlayerScoreSetFunction::Set);
-    return result == ScoreboardOperationResult::Success;
+    Objective* obj = _resolveObjective();
+    return obj && _modify(player, *obj, amount, PlayerScoreSetFunction::Set);
 }
 bool ScoreBoardInterface::set(mce::UUID const& uuid, llong amount) const {
     auto player = ll::service::getLevel()->getPlayer(uuid);
@@ -79,24 +79,8 @@ bool ScoreBoardInterface::set(mce::UUID const& uuid, llong amount) const {
 }
 
 bool ScoreBoardInterface::add(Player& player, llong amount) const {
-    auto& cfg = getConfig();
-
-    Scoreboard& scoreboard = ll::service::getLevel()->getScoreboard();
-    Objective*  obj        = scoreboard.getObjective(cfg.scoreboardName);
-    if (!obj) {
-        land::PLand::getInstance().getSelf().getLogger().error(
-            "[ScoreBoardInterface] Could not find scoreboard: {}",
-            cfg.scoreboardName
-        );
-        return false;
-    }
-    const ScoreboardId& id = scoreboard.getScoreboardId(player);
-    if (id.mRawID == ScoreboardId::INVALID().mRawID) {
-        scoreboard.createScoreboardId(player);
-    }
-    ScoreboardOperationResult result;
-    scoreboard.modifyPlayerScore(result, id, *obj, static_cast<int>(amount), PlayerScoreSetFunction::Add);
-    return result == ScoreboardOperationResult::Success;
+    Objective* obj = _resolveObjective();
+    return obj && _modify(player, *obj, amount, PlayerScoreSetFunction::Add);
 }
 bool ScoreBoardInterface::add(mce::UUID const& uuid, llong amount) const {
     auto player = ll::service::getLevel()->getPlayer(uuid);
@@ -110,26 +94,33 @@ bool ScoreBoardInterface::add(mce::UUID const& uuid, llong amount) const {
 }
 
 bool ScoreBoardInterface::reduce(Player& player, llong amount) const {
-    auto& cfg = getConfig();
-
-    Scoreboard& scoreboard = ll::service::getLevel()->getScoreboard();
-    Objective*  obj        = scoreboard.getObjective(cfg.scoreboardName);
-    if (!obj) {
+    Objective* obj = _resolveObjective();
+    return obj && _modify(player, *obj, amount, PlayerScoreSetFunction::Subtract);
+}
+bool ScoreBoardInterface::reduce(mce::UUID const& uuid, llong amount) const {
+    auto player = ll::service::getLevel()->getPlayer(uuid);
+    if (!player) {
         land::PLand::getInstance().getSelf().getLogger().error(
-            "[ScoreBoardInterface] Could not find scoreboard: {}",
-            cfg.scoreboardName
+            "[ScoreBoardInterface] Offline operations on the scoreboard are not supported"
         );
         return false;
     }
-    const ScoreboardId& id = scoreboard.getScoreboardId(player);
-    if (id.mRawID == ScoreboardId::INVALID().mRawID) {
-        scoreboard.createScoreboardId(player);
+    return reduce(*player, amount);
+}
+
+bool ScoreBoardInterface::tryReduce(Player& player, llong amount) const {
+    Objective* obj = _resolveObjective();
+    if (!obj) {
+        return false;
     }
-    ScoreboardOperationResult result;
-    scoreboard.modifyPlayerScore(result, id, *obj, static_cast<int>(amount), PlayerScoreSetFunction::Subtract);
-    return result == ScoreboardOperationResult::Success;
+    // 同一个 Objective 上完成检查与扣除
+    auto score = obj->getPlayerScore(_resolveId(ll::service::getLevel()->getScoreboard(), player)).mValue;
+    if (score < amount) {
+        return false;
+    }
+    return _modify(player, *obj, amount, PlayerScoreSetFunction::Subtract);
 }
-bool ScoreBoardInterface::reduce(mce::UUID const& uuid, llong amount) const {
+bool ScoreBoardInterface::tryReduce(mce::UUID const& uuid, llong amount) const {
     auto player = ll::service::getLevel()->getPlayer(uuid);
     if (!player) {
         land::PLand::getInstance().getSelf().getLogger().error(
@@ -137,15 +128,19 @@ bool ScoreBoardInterface::reduce(mce::UUID const& uuid, llong amount) const {
         );
         return false;
     }
-    return reduce(*player, amount);
+    return tryReduce(*player, amount);
 }
 
 bool ScoreBoardInterface::transfer(Player& from, Player& to, llong amount) const {
-    if (!reduce(from, amount)) {
+    Objective* obj = _resolveObjective();
+    if (!obj) {
+        return false;
+    }
+    if (!_modify(from, *obj, amount, PlayerScoreSetFunction::Subtract)) {
         return false;
     }
-    if (!add(to, amount)) {
-        (void)add(from, amount); // rollback
+    if (!_modify(to, *obj, amount, PlayerScoreSetFunction::Add)) {
+        (void)_modify(from, *obj, amount, PlayerScoreSetFunction::Add); // rollback
         return false;
     }
     return true;
@@ -164,4 +159,4 @@ bool ScoreBoardInterface::transfer(mce::UUID const& from, mce::UUID const& to, l
 }
 
 
-} // namespace land::internals
\ No newline at end of file
+} // namespace land::internals
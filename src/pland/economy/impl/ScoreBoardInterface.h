@@ -1,6 +1,11 @@
 #pragma once
 #include "IEconomyInterface.h"
 #include "pland/economy/impl/IEconomyInterface.h"
+#include <mc/world/scores/PlayerScoreSetFunction.h>
+#include <mc/world/scores/ScoreboardId.h>
+
+class Objective;
+class Scoreboard;
 
 namespace land ::internals {
 
@@ -24,6 +29,20 @@ class ScoreBoardInterface final : public IEconomyInterface {
 
     LDNDAPI bool transfer(Player& from, Player& to, llong amount) const override;
     LDNDAPI bool transfer(mce::UUID const& from, mce::UUID const& to, llong amount) const override;
+
+    LDNDAPI bool tryReduce(Player& player, llong amount) const override;
+    LDNDAPI bool tryReduce(mce::UUID const& uuid, llong amount) const override;
+
+private:
+    /**
+     * @brief 单次操作内解析一次计分板对象，多个步骤(检查、扣除、转账)共用
+     * @note 不跨调用缓存 Objective*，计分板被移除后指针会悬空
+     */
+    Objective* _resolveObjective() const;
+
+    static ScoreboardId const& _resolveId(Scoreboard& scoreboard, Player& player);
+
+    static bool _modify(Player& player, Objective& obj, llong amount, PlayerScoreSetFunction action);
 };
 
 
@@ -61,10 +61,10 @@ void LandBuyGUI::impl(Player& player, DefaultSelector* selector) {
     int const  width  = aabb->getWidth();
     int const  height = aabb->getHeight();
 
-    auto   _variables    = PriceCalculate::Variable::make(*aabb, selector->getDimensionId()); // 传入维度ID
     double originalPrice = PriceCalculate::eval(
         is3D ? Config::cfg.land.bought.threeDimensionl.calculate : Config::cfg.land.bought.twoDimensionl.calculate,
-        _variables
+        *aabb,
+        selector->getDimensionId()
     );
 
     // 应用维度价格系数
@@ -108,10 +108,6 @@ void LandBuyGUI::impl(Player& player, DefaultSelector* selector) {
         "path",
         [discountedPrice, selector](Player& pl) {
             auto& economy = EconomySystem::getInstance();
-            if (economy->get(pl) < discountedPrice && Config::cfg.economy.enabled) {
-                mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
-                return; // 预检查经济
-            }
 
             SharedLand landPtr = selector->newLand();
 
@@ -120,8 +116,8 @@ void LandBuyGUI::impl(Player& player, DefaultSelector* selector) {
                 return;
             }
 
-            // 扣除经济
-            if (!economy->reduce(pl, discountedPrice)) {
+            // 检查并扣除经济
+            if (!economy->tryReduce(pl, discountedPrice)) {
                 mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
                 return;
             }
@@ -160,8 +156,8 @@ void LandBuyGUI::impl(Player& player, ChangeLandRangeSelector* reSelector) {
 
     auto       landPtr       = reSelector->getLand();
     int const& originalPrice = landPtr->getOriginalBuyPrice(); // 原始购买价格
-    auto       _variables    = PriceCalculate::Variable::make(*aabb, landPtr->getDimensionId());
-    double     newRangePrice = PriceCalculate::eval(Config::cfg.land.bought.threeDimensionl.calculate, _variables);
+    double     newRangePrice =
+        PriceCalculate::eval(Config::cfg.land.bought.threeDimensionl.calculate, *aabb, landPtr->getDimensionId());
 
     // 应用维度价格系数
     auto it = Config::cfg.land.bought.dimensionPriceCoefficients.find(std::to_string(landPtr->getDimensionId()));
@@ -209,10 +205,6 @@ void LandBuyGUI::impl(Player& player, ChangeLandRangeSelector* reSelector) {
         "path",
         [needPay, refund, discountedPrice, aabb, landPtr](Player& pl) {
             auto& eco = EconomySystem::getInstance();
-            if ((needPay > 0 && eco->get(pl) < needPay) && Config::cfg.economy.enabled) {
-                mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
-                return; // 预检查经济
-            }
 
             if (auto res = LandCreateValidator::validateChangeLandRange(landPtr, *aabb); !res) {
                 LandCreateValidator::sendErrorMessage(pl, res.error());
@@ -221,7 +213,7 @@ void LandBuyGUI::impl(Player& player, ChangeLandRangeSelector* reSelector) {
 
             // 补差价 & 退还差价
             if (needPay > 0) {
-                if (!eco->reduce(pl, needPay)) {
+                if (!eco->tryReduce(pl, needPay)) {
                     mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
                     return;
                 }
@@ -262,8 +254,8 @@ void LandBuyGUI::impl(Player& player, SubLandSelector* subSelector) {
     int const  width  = subLandRange->getWidth();
     int const  height = subLandRange->getHeight();
 
-    auto   _variables    = PriceCalculate::Variable::make(*subLandRange, subSelector->getDimensionId()); // 传入维度ID
-    double originalPrice = PriceCalculate::eval(Config::cfg.land.subLand.calculate, _variables);
+    double originalPrice =
+        PriceCalculate::eval(Config::cfg.land.subLand.calculate, *subLandRange, subSelector->getDimensionId());
 
     // 应用维度价格系数
     auto it = Config::cfg.land.bought.dimensionPriceCoefficients.find(std::to_string(subSelector->getDimensionId()));
@@ -317,10 +309,6 @@ void LandBuyGUI::impl(Player& player, SubLandSelector* subSelector) {
         "path",
         [discountedPrice, subLandRange, subSelector](Player& pl) {
             auto& economy = EconomySystem::getInstance();
-            if (economy->get(pl) < discountedPrice && Config::cfg.economy.enabled) {
-                mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
-                return; // 预检查经济
-            }
 
             if (auto res = LandCreateValidator::validateCreateSubLand(pl, subSelector->getParentLand(), *subLandRange);
                 !res) {
@@ -328,8 +316,8 @@ void LandBuyGUI::impl(Player& player, SubLandSelector* subSelector) {
                 return;
             }
 
-            // 扣除经济
-            if (!economy->reduce(pl, discountedPrice)) {
+            // 检查并扣除经济
+            if (!economy->tryReduce(pl, discountedPrice)) {
                 mc_utils::sendText<mc_utils::LogLevel::Error>(pl, "您的余额不足，无法购买"_trf(pl));
                 return;
             }
@@ -11,7 +11,7 @@
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/aabb/LandAABB.h"
-#include "pland/economy/EconomySystem.h"
+#include "pland/economy/EconomyLedger.h"
 #include "pland/economy/PriceCalculate.h"
 #include "pland/gui/CommonUtilGUI.h"
 #include "pland/gui/common/EditLandPermTableUtilGUI.h"
@@ -39,6 +39,26 @@ using namespace ll::form;
 
 namespace land {
 
+namespace {
+
+// 退款给领地主人，主人不在线时记入经济账本，上线后结算
+void refundToOwner(Player& player, SharedLand const& land, llong amount) {
+    if (amount <= 0) {
+        return;
+    }
+    auto settlement = PLand::getInstance().getEconomyLedger()->credit(
+        land->getOwner(),
+        amount,
+        EconomyLedger::makeKey("refund", land->getId()),
+        "land refund"
+    );
+    if (settlement == EconomyLedger::Settlement::Queued) {
+        mc_utils::sendText(player, "退款已记入账本，将在领地主人上线后发放"_trf(player));
+    }
+}
+
+} // namespace
+
 
 void LandManagerGUI::sendMainMenu(Player& player, SharedLand land) {
     auto fm = BackSimpleForm<>::make();
@@ -169,17 +189,12 @@ void LandManagerGUI::_implRemoveWithOrdinaryOrSubLandGUI(Player& player, SharedL
                 return;
             }
 
-            auto& economy = EconomySystem::getInstance();
-            if (!economy->add(pl, price)) {
-                return;
-            }
-
             auto result = ptr->isSubLand() ? PLand::getInstance().getLandRegistry()->removeSubLand(ptr)
                                            : PLand::getInstance().getLandRegistry()->removeOrdinaryLand(ptr);
             if (!result) {
-                economy->reduce(pl, price);
                 return;
             }
+            refundToOwner(pl, ptr, price);
 
             auto handle = PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(pl);
             handle->remove(ptr);
@@ -209,16 +224,11 @@ void LandManagerGUI::_implRemoveParentLandGUI(Player& player, SharedLand const&
             return;
         }
 
-        auto& economy = EconomySystem::getInstance();
-        if (!economy->add(pl, price)) {
-            return;
-        }
-
         auto result = PLand::getInstance().getLandRegistry()->removeLandAndSubLands(ptr);
         if (!result) {
-            economy->reduce(pl, price);
             return;
         }
+        refundToOwner(pl, ptr, price);
 
         auto subLands = ptr->getSelfAndDescendants();
         auto handle   = PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(pl);
@@ -238,16 +248,11 @@ void LandManagerGUI::_implRemoveParentLandGUI(Player& player, SharedLand const&
             return;
         }
 
-        auto& economy = EconomySystem::getInstance();
-        if (!economy->add(pl, refundPrice)) {
-            return;
-        }
-
         auto result = PLand::getInstance().getLandRegistry()->removeLandAndPromoteSubLands(ptr);
         if (!result) {
-            economy->reduce(pl, refundPrice);
             return;
         }
+        refundToOwner(pl, ptr, refundPrice);
 
 
         PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(pl)->remove(ptr);
@@ -277,16 +282,11 @@ void LandManagerGUI::_implRemoveMixLandGUI(Player& player, SharedLand const& ptr
             return;
         }
 
-        auto& economy = EconomySystem::getInstance();
-        if (!economy->add(pl, price)) {
-            return;
-        }
-
         auto result = PLand::getInstance().getLandRegistry()->removeLandAndSubLands(ptr);
         if (!result) {
-            economy->reduce(pl, price);
             return;
         }
+        refundToOwner(pl, ptr, price);
 
         auto subLands = ptr->getSelfAndDescendants();
         auto handle   = PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(pl);
@@ -306,16 +306,11 @@ void LandManagerGUI::_implRemoveMixLandGUI(Player& player, SharedLand const& ptr
             return;
         }
 
-        auto& economy = EconomySystem::getInstance();
-        if (!economy->add(pl, refundPrice)) {
-            return;
-        }
-
         auto result = PLand::getInstance().getLandRegistry()->removeLandAndTransferSubLands(ptr);
         if (!result) {
-            economy->reduce(pl, refundPrice);
             return;
         }
+        refundToOwner(pl, ptr, refundPrice);
 
         PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(pl)->remove(ptr);
         ll::event::EventBus::getInstance().publish(PlayerDeleteLandAfterEvent{pl, ptr->getId()});
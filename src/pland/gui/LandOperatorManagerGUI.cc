@@ -3,10 +3,12 @@
 #include "LandManagerGUI.h"
 #include "ll/api/service/PlayerInfo.h"
 #include "pland/PLand.h"
+#include "pland/economy/PriceCalculate.h"
 #include "pland/gui/common/ChooseLandAdvancedUtilGUI.h"
 #include "pland/gui/common/EditLandPermTableUtilGUI.h"
 #include "pland/gui/form/BackPaginatedSimpleForm.h"
 #include "pland/gui/form/BackSimpleForm.h"
+#include "pland/infra/Config.h"
 #include "pland/land/LandContext.h"
 #include "pland/land/LandRegistry.h"
 #include "pland/land/LandTemplatePermTable.h"
@@ -110,18 +112,25 @@ void LandOperatorManagerGUI::sendChooseLandGUI(Player& player, std::vector<Share
         );
     });
 
+    // 开启经济时显示按当前配置估算的价格，整个列表一次批量求值
+    std::vector<int> prices;
+    if (Config::cfg.economy.enabled) {
+        prices = PriceCalculate::appraise(lands);
+    }
+
     auto const& infos = ll::service::PlayerInfo::getInstance();
-    for (auto const& ptr : lands) {
-        auto info = infos.fromUuid(UUIDm::fromString(ptr->getOwner()));
-        fm.appendButton(
-            "{}\nID: {}  玩家: {}"_trf(
-                player,
-                ptr->getName(),
-                ptr->getId(),
-                info.has_value() ? info->name : ptr->getOwner()
-            ),
-            [ptr](Player& self) { LandManagerGUI::sendMainMenu(self, ptr); }
-        );
+    for (size_t i = 0; i < lands.size(); ++i) {
+        auto const& ptr  = lands[i];
+        auto        info = infos.fromUuid(UUIDm::fromString(ptr->getOwner()));
+        auto        name = info.has_value() ? info->name : ptr->getOwner();
+
+        std::string text;
+        if (prices.empty()) {
+            text = "{}\nID: {}  玩家: {}"_trf(player, ptr->getName(), ptr->getId(), name);
+        } else {
+            text = "{}\nID: {}  玩家: {}  估价: {}"_trf(player, ptr->getName(), ptr->getId(), name, prices[i]);
+        }
+        fm.appendButton(text, [ptr](Player& self) { LandManagerGUI::sendMainMenu(self, ptr); });
     }
 
     fm.sendTo(player);
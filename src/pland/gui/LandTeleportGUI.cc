@@ -31,7 +31,8 @@ void LandTeleportGUI::impl(Player& player, SharedLand land) {
         }
         PLand::getInstance().getSafeTeleport()->launchTask(
             player,
-            {land->getAABB().getMin().as(), land->getDimensionId()}
+            {land->getAABB().getMin().as(), land->getDimensionId()},
+            land->getId()
         );
         return;
     }
@@ -0,0 +1,60 @@
+#include "pland/hooks/ChunkLoadHook.h"
+#include "ll/api/memory/Hook.h"
+#include "mc/world/level/ChunkPos.h"
+#include "mc/world/level/chunk/LevelChunk.h"
+#include "mc/world/level/dimension/Dimension.h"
+#include <utility>
+#include <vector>
+
+
+namespace land {
+
+
+LL_TYPE_INSTANCE_HOOK(
+    DimensionChunkLoadedHook,
+    ll::memory::HookPriority::Normal,
+    Dimension,
+    &Dimension::$onChunkLoaded,
+    void,
+    ::ChunkSource& source,
+    ::LevelChunk&  lc
+) {
+    origin(source, lc);
+    auto const& pos = lc.getPosition();
+    ChunkLoadHook::notify(getDimensionId().id, pos.x, pos.z);
+}
+
+
+namespace {
+
+// 只在服务器线程访问
+std::vector<std::pair<ChunkLoadHook::Handle, ChunkLoadHook::Callback>> gSubscribers;
+ChunkLoadHook::Handle                                                   gNextHandle{1};
+
+} // namespace
+
+
+ChunkLoadHook::Handle ChunkLoadHook::subscribe(Callback callback) {
+    if (gSubscribers.empty()) {
+        DimensionChunkLoadedHook::hook();
+    }
+    auto handle = gNextHandle++;
+    gSubscribers.emplace_back(handle, std::move(callback));
+    return handle;
+}
+
+void ChunkLoadHook::unsubscribe(Handle handle) {
+    auto removed = std::erase_if(gSubscribers, [handle](auto const& pair) { return pair.first == handle; });
+    if (removed && gSubscribers.empty()) {
+        DimensionChunkLoadedHook::unhook();
+    }
+}
+
+void ChunkLoadHook::notify(LandDimid dimId, int chunkX, int chunkZ) {
+    for (auto const& [handle, callback] : gSubscribers) { // 回调中不得订阅或退订
+        callback(dimId, chunkX, chunkZ);
+    }
+}
+
+
+} // namespace land
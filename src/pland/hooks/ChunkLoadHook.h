@@ -0,0 +1,33 @@
+#pragma once
+#include "pland/Global.h"
+#include <cstdint>
+#include <functional>
+
+
+namespace land {
+
+
+/**
+ * @brief 区块加载通知
+ * 挂钩 Dimension::onChunkLoaded，区块加载完成时在服务器线程回调订阅者；
+ * 钩子只在存在订阅者时安装，最后一个订阅者退订后卸载
+ */
+class ChunkLoadHook {
+public:
+    using Callback = std::function<void(LandDimid dimId, int chunkX, int chunkZ)>;
+    using Handle   = uint64_t;
+
+    LD_DISALLOW_COPY_AND_MOVE(ChunkLoadHook);
+
+    LDNDAPI static Handle subscribe(Callback callback);
+
+    LDAPI static void unsubscribe(Handle handle);
+
+    static void notify(LandDimid dimId, int chunkX, int chunkZ); // 由钩子调用
+
+private:
+    ChunkLoadHook() = default;
+};
+
+
+} // namespace land
@@ -28,6 +28,7 @@ void EventListener::registerILAEntityListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.ActorDestroyBlockEvent, [&]() {
         return bus->emplaceListener<ila::mc::ActorDestroyBlockEvent>([db, logger](ila::mc::ActorDestroyBlockEvent& ev) {
+            LD_TRACE_SPAN("ActorDestroyBlockEvent");
             auto& actor    = ev.self();
             auto& blockPos = ev.pos();
             logger->debug("[ActorDestroyBlock] Actor: {}, Pos: {}", actor.getTypeName(), blockPos.toString());
@@ -41,6 +42,7 @@ void EventListener::registerILAEntityListeners() {
     RegisterListenerIf(Config::cfg.listeners.EndermanLeaveBlockEvent, [&]() {
         return bus->emplaceListener<ila::mc::EndermanLeaveBlockBeforeEvent>(
             [db, logger](ila::mc::EndermanLeaveBlockBeforeEvent& ev) {
+                LD_TRACE_SPAN("EndermanLeaveBlockBeforeEvent");
                 auto& actor    = ev.self();
                 auto& blockPos = ev.pos();
                 logger->debug("[EndermanLeave] Actor: {}, Pos: {}", actor.getTypeName(), blockPos.toString());
@@ -55,6 +57,7 @@ void EventListener::registerILAEntityListeners() {
     RegisterListenerIf(Config::cfg.listeners.EndermanTakeBlockEvent, [&]() {
         return bus->emplaceListener<ila::mc::EndermanTakeBlockBeforeEvent>(
             [db, logger](ila::mc::EndermanTakeBlockBeforeEvent& ev) {
+                LD_TRACE_SPAN("EndermanTakeBlockBeforeEvent");
                 auto& actor    = ev.self();
                 auto& blockPos = ev.pos();
                 logger->debug("[EndermanTake] Actor: {}, Pos: {}", actor.getTypeName(), blockPos.toString());
@@ -68,6 +71,7 @@ void EventListener::registerILAEntityListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.ActorRideBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::ActorRideBeforeEvent>([db, logger](ila::mc::ActorRideBeforeEvent& ev) {
+            LD_TRACE_SPAN("ActorRideBeforeEvent");
             Actor& passenger = ev.self();
             Actor& target    = ev.target();
             logger->debug(
@@ -101,6 +105,7 @@ void EventListener::registerILAEntityListeners() {
     RegisterListenerIf(Config::cfg.listeners.MobHurtEffectBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::MobHurtEffectBeforeEvent>([db,
                                                                         logger](ila::mc::MobHurtEffectBeforeEvent& ev) {
+            LD_TRACE_SPAN("MobHurtEffectBeforeEvent");
             auto& hurtActor = ev.self();
 
             auto hurtSource = ev.source();
@@ -132,6 +137,7 @@ void EventListener::registerILAEntityListeners() {
     RegisterListenerIf(Config::cfg.listeners.ActorTriggerPressurePlateBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::ActorTriggerPressurePlateBeforeEvent>(
             [db, logger](ila::mc::ActorTriggerPressurePlateBeforeEvent& ev) {
+                LD_TRACE_SPAN("ActorTriggerPressurePlateBeforeEvent");
                 logger->debug("[PressurePlateTrigger] pos: {}", ev.pos().toString());
                 auto land = db->getLandAt(ev.pos(), ev.self().getDimensionId());
                 if (land && land->getPermTable().usePressurePlate) return;
@@ -149,6 +155,7 @@ void EventListener::registerILAEntityListeners() {
     RegisterListenerIf(Config::cfg.listeners.ProjectileCreateBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::ProjectileCreateBeforeEvent>(
             [db, logger](ila::mc::ProjectileCreateBeforeEvent& ev) {
+                LD_TRACE_SPAN("ProjectileCreateBeforeEvent");
                 Actor& self = ev.self();
                 auto&  type = ev.self().getTypeName();
                 logger->debug("[ProjectileSpawn] type: {}", type);
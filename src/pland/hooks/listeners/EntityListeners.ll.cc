@@ -21,6 +21,7 @@ void EventListener::registerLLEntityListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.SpawnedMobEvent, [&]() {
         return bus->emplaceListener<ll::event::SpawnedMobEvent>([db, logger](ll::event::SpawnedMobEvent& ev) {
+            LD_TRACE_SPAN("SpawnedMobEvent");
             auto mob = ev.mob();
             if (!mob.has_value()) return;
             auto& pos = mob->getPosition();
@@ -4,6 +4,7 @@
 #include "mc/world/level/block/BlockProperty.h"
 
 #include "pland/PLand.h"
+#include "pland/infra/SpanTracer.h"
 #include "pland/land/Land.h"
 #include "pland/land/LandRegistry.h"
 
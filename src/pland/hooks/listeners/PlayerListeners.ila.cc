@@ -27,6 +27,7 @@ void EventListener::registerILAPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerInteractEntityBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::PlayerInteractEntityBeforeEvent>(
             [db, logger](ila::mc::PlayerInteractEntityBeforeEvent& ev) {
+                LD_TRACE_SPAN("PlayerInteractEntityBeforeEvent");
                 logger->debug("[交互实体] name: {}", ev.self().getRealName());
                 auto& entity = ev.target();
                 auto  land   = db->getLandAt(entity.getPosition(), ev.self().getDimensionId());
@@ -41,6 +42,7 @@ void EventListener::registerILAPlayerListeners() {
         return bus->emplaceListener<ila::mc::PlayerAttackBlockBeforeEvent>([db, logger](
                                                                                ila::mc::PlayerAttackBlockBeforeEvent& ev
                                                                            ) {
+            LD_TRACE_SPAN("PlayerAttackBlockBeforeEvent");
             auto& self = ev.self();
             auto& pos  = ev.pos();
             logger->debug("[AttackBlock] {}", pos.toString());
@@ -54,6 +56,7 @@ void EventListener::registerILAPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.ArmorStandSwapItemBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::ArmorStandSwapItemBeforeEvent>(
             [db, logger](ila::mc::ArmorStandSwapItemBeforeEvent& ev) {
+                LD_TRACE_SPAN("ArmorStandSwapItemBeforeEvent");
                 Player& player = ev.player();
                 logger->debug("[ArmorStandSwapItem]: executed");
                 auto land = db->getLandAt(ev.self().getPosition(), player.getDimensionId());
@@ -69,6 +72,7 @@ void EventListener::registerILAPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerDropItemBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::PlayerDropItemBeforeEvent>(
             [db, logger](ila::mc::PlayerDropItemBeforeEvent& ev) {
+                LD_TRACE_SPAN("PlayerDropItemBeforeEvent");
                 Player& player = ev.self();
                 logger->debug("[PlayerDropItem]: executed");
                 auto land = db->getLandAt(player.getPosition(), player.getDimensionId());
@@ -84,6 +88,7 @@ void EventListener::registerILAPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerOperatedItemFrameBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::PlayerOperatedItemFrameBeforeEvent>(
             [db, logger](ila::mc::PlayerOperatedItemFrameBeforeEvent& ev) {
+                LD_TRACE_SPAN("PlayerOperatedItemFrameBeforeEvent");
                 logger->debug("[PlayerUseItemFrame] pos: {}", ev.blockPos().toString());
                 auto land = db->getLandAt(ev.blockPos(), ev.self().getDimensionId());
                 if (PreCheckLandExistsAndPermission(land, ev.self().getUuid().asString())) return;
@@ -96,6 +101,7 @@ void EventListener::registerILAPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerEditSignBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::PlayerEditSignBeforeEvent>(
             [db, logger](ila::mc::PlayerEditSignBeforeEvent& ev) {
+                LD_TRACE_SPAN("PlayerEditSignBeforeEvent");
                 auto& player = ev.self();
                 auto& pos    = ev.pos();
                 logger->debug("[PlayerEditSign] {} -> {}", player.getRealName(), pos.toString());
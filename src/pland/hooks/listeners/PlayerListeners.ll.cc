@@ -115,6 +115,7 @@ void EventListener::registerLLPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerDestroyBlockEvent, [&]() {
         return bus->emplaceListener<ll::event::PlayerDestroyBlockEvent>(
             [db, logger](ll::event::PlayerDestroyBlockEvent& ev) {
+                LD_TRACE_SPAN("PlayerDestroyBlockEvent");
                 auto& player   = ev.self();
                 auto& blockPos = ev.pos();
                 logger->debug(
@@ -142,6 +143,7 @@ void EventListener::registerLLPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerPlacingBlockEvent, [&]() {
         return bus->emplaceListener<ll::event::PlayerPlacingBlockEvent>(
             [db, logger](ll::event::PlayerPlacingBlockEvent& ev) {
+                LD_TRACE_SPAN("PlayerPlacingBlockEvent");
                 auto&       player   = ev.self();
                 auto const& blockPos = mc_utils::face2Pos(ev.pos(), ev.face());
                 logger->debug(
@@ -170,6 +172,7 @@ void EventListener::registerLLPlayerListeners() {
         return bus->emplaceListener<ll::event::PlayerInteractBlockEvent>([db, logger](
                                                                              ll::event::PlayerInteractBlockEvent& ev
                                                                          ) {
+            LD_TRACE_SPAN("PlayerInteractBlockEvent");
             auto&       player             = ev.self();
             auto&       pos                = ev.blockPos();
             auto&       itemStack          = ev.item();
@@ -306,6 +309,7 @@ void EventListener::registerLLPlayerListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.PlayerAttackEvent, [&]() {
         return bus->emplaceListener<ll::event::PlayerAttackEvent>([db, logger](ll::event::PlayerAttackEvent& ev) {
+            LD_TRACE_SPAN("PlayerAttackEvent");
             auto& player = ev.self();
             auto& mob    = ev.target();
             auto& pos    = mob.getPosition();
@@ -355,6 +359,7 @@ void EventListener::registerLLPlayerListeners() {
     RegisterListenerIf(Config::cfg.listeners.PlayerPickUpItemEvent, [&]() {
         return bus->emplaceListener<ll::event::PlayerPickUpItemEvent>([db,
                                                                        logger](ll::event::PlayerPickUpItemEvent& ev) {
+            LD_TRACE_SPAN("PlayerPickUpItemEvent");
             auto& player = ev.self();
             auto& item   = ev.itemActor();
             auto& pos    = item.getPosition();
@@ -8,11 +8,13 @@
 
 #include "pland/Global.h"
 #include "pland/PLand.h"
+#include "pland/economy/EconomyLedger.h"
 #include "pland/infra/DrawHandleManager.h"
 #include "pland/infra/draw/IDrawHandle.h"
 #include "pland/land/LandRegistry.h"
 #include "pland/land/LandScheduler.h"
 #include "pland/selector/SelectorManager.h"
+#include "pland/utils/McUtils.h"
 
 
 namespace land {
@@ -25,6 +27,7 @@ void EventListener::registerLLSessionListeners() {
     // PlayerJoin and PlayerDisconnect are fundamental and not behind a config flag.
     mListenerPtrs.push_back(bus->emplaceListener<ll::event::PlayerJoinEvent>([db,
                                                                               logger](ll::event::PlayerJoinEvent& ev) {
+        LD_TRACE_SPAN("PlayerJoinEvent");
         if (ev.self().isSimulatedPlayer()) return;
         if (!db->hasPlayerSettings(ev.self().getUuid().asString())) {
             db->setPlayerSettings(ev.self().getUuid().asString(), PlayerSettings{}); // 新玩家
@@ -38,17 +41,22 @@ void EventListener::registerLLSessionListeners() {
                 land->updateXUIDToUUID(uuid);
             }
         }
+
+        // 结算离线期间的经济变动
+        if (auto settled = PLand::getInstance().getEconomyLedger()->settle(ev.self()); settled > 0) {
+            mc_utils::sendText(ev.self(), "已结算 {0} 笔离线期间的经济变动"_trf(ev.self(), settled));
+        }
     }));
     mListenerPtrs.push_back(
         bus->emplaceListener<ll::event::PlayerDisconnectEvent>([logger](ll::event::PlayerDisconnectEvent& ev) {
+            LD_TRACE_SPAN("PlayerDisconnectEvent");
             auto& player = ev.self();
             if (player.isSimulatedPlayer()) return;
             logger->debug("Player {} disconnect, remove all resources");
 
-            auto& uuid    = player.getUuid();
-            auto  uuidStr = uuid.asString();
+            auto& uuid = player.getUuid();
 
-            GlobalPlayerLocaleCodeCached.erase(uuidStr);
+            GlobalPlayerLocaleCodeCached.erase(uuid);
             land::PLand::getInstance().getSelectorManager()->stopSelection(uuid);
             PLand::getInstance().getDrawHandleManager()->removeHandle(player);
         })
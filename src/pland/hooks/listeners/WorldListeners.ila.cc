@@ -33,6 +33,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.ExplosionBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::ExplosionBeforeEvent>([db, logger](ila::mc::ExplosionBeforeEvent& ev) {
+            LD_TRACE_SPAN("ExplosionBeforeEvent");
             logger->debug("[Explode] Pos: {}", ev.explosion().mPos->toString());
             auto lands = db->getLandAt(
                 BlockPos{ev.explosion().mPos},
@@ -50,6 +51,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.FarmDecayBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::FarmDecayBeforeEvent>([db, logger](ila::mc::FarmDecayBeforeEvent& ev) {
+            LD_TRACE_SPAN("FarmDecayBeforeEvent");
             logger->debug("[FarmDecay] Pos: {}", ev.pos().toString());
             auto land = db->getLandAt(ev.pos(), ev.blockSource().getDimensionId());
             if (PreCheckLandExistsAndPermission(land) || (land && land->getPermTable().allowFarmDecay)) return;
@@ -59,6 +61,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.PistonPushBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::PistonPushBeforeEvent>([db, logger](ila::mc::PistonPushBeforeEvent& ev) {
+            LD_TRACE_SPAN("PistonPushBeforeEvent");
             auto const& piston     = ev.pistonPos();
             auto const& push       = ev.pushPos();
             auto const  dimid      = ev.blockSource().getDimensionId();
@@ -83,6 +86,7 @@ void EventListener::registerILAWorldListeners() {
     RegisterListenerIf(Config::cfg.listeners.RedstoneUpdateBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::RedstoneUpdateBeforeEvent>(
             [db, logger](ila::mc::RedstoneUpdateBeforeEvent& ev) {
+                LD_TRACE_SPAN("RedstoneUpdateBeforeEvent");
                 auto land = db->getLandAt(ev.pos(), ev.blockSource().getDimensionId());
                 if (PreCheckLandExistsAndPermission(land) || (land && land->getPermTable().allowRedstoneUpdate)) return;
                 ev.cancel();
@@ -92,6 +96,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.BlockFallBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::BlockFallBeforeEvent>([db, logger](ila::mc::BlockFallBeforeEvent& ev) {
+            LD_TRACE_SPAN("BlockFallBeforeEvent");
             auto land = db->getLandAt(ev.pos(), ev.blockSource().getDimensionId());
             if (land) {
                 auto const& tab = land->getPermTable();
@@ -106,6 +111,7 @@ void EventListener::registerILAWorldListeners() {
     RegisterListenerIf(Config::cfg.listeners.WitherDestroyBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::WitherDestroyBeforeEvent>([db,
                                                                         logger](ila::mc::WitherDestroyBeforeEvent& ev) {
+            LD_TRACE_SPAN("WitherDestroyBeforeEvent");
             auto& aabb  = ev.box();
             auto  lands = db->getLandAt(aabb.min, aabb.max, ev.blockSource().getDimensionId());
             for (auto const& p : lands) {
@@ -119,6 +125,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.MossGrowthBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::MossGrowthBeforeEvent>([db, logger](ila::mc::MossGrowthBeforeEvent& ev) {
+            LD_TRACE_SPAN("MossGrowthBeforeEvent");
             auto const& pos  = ev.pos();
             auto        land = db->getLandAt(pos, ev.blockSource().getDimensionId());
             if (!land || land->getPermTable().useBoneMeal) return;
@@ -132,6 +139,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.LiquidTryFlowBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::LiquidFlowBeforeEvent>([db, logger](ila::mc::LiquidFlowBeforeEvent& ev) {
+            LD_TRACE_SPAN("LiquidFlowBeforeEvent");
             auto& sou    = ev.flowFromPos();
             auto& to     = ev.pos();
             auto  landTo = db->getLandAt(to, ev.blockSource().getDimensionId());
@@ -145,6 +153,7 @@ void EventListener::registerILAWorldListeners() {
     RegisterListenerIf(Config::cfg.listeners.DragonEggBlockTeleportBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::DragonEggBlockTeleportBeforeEvent>(
             [db, logger](ila::mc::DragonEggBlockTeleportBeforeEvent& ev) {
+                LD_TRACE_SPAN("DragonEggBlockTeleportBeforeEvent");
                 auto land = db->getLandAt(ev.pos(), ev.blockSource().getDimensionId());
                 if (land && !land->getPermTable().allowAttackDragonEgg) {
                     ev.cancel();
@@ -156,6 +165,7 @@ void EventListener::registerILAWorldListeners() {
     RegisterListenerIf(Config::cfg.listeners.SculkBlockGrowthBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::SculkBlockGrowthBeforeEvent>(
             [db, logger](ila::mc::SculkBlockGrowthBeforeEvent& ev) {
+                LD_TRACE_SPAN("SculkBlockGrowthBeforeEvent");
                 auto land = db->getLandAt(ev.pos(), ev.blockSource().getDimensionId());
                 if (land && !land->getPermTable().allowSculkBlockGrowth) {
                     ev.cancel();
@@ -166,6 +176,7 @@ void EventListener::registerILAWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.SculkSpreadBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::SculkSpreadBeforeEvent>([db, logger](ila::mc::SculkSpreadBeforeEvent& ev) {
+            LD_TRACE_SPAN("SculkSpreadBeforeEvent");
             auto sou = db->getLandAt(ev.selfPos(), ev.blockSource().getDimensionId());
             auto tar = db->getLandAt(ev.targetPos(), ev.blockSource().getDimensionId());
             if (!sou && tar) {
@@ -177,6 +188,7 @@ void EventListener::registerILAWorldListeners() {
     RegisterListenerIf(Config::cfg.listeners.SculkCatalystAbsorbExperienceBeforeEvent, [&]() {
         return bus->emplaceListener<ila::mc::SculkCatalystAbsorbExperienceBeforeEvent>(
             [db, logger](ila::mc::SculkCatalystAbsorbExperienceBeforeEvent& ev) {
+                LD_TRACE_SPAN("SculkCatalystAbsorbExperienceBeforeEvent");
                 auto& actor  = ev.actor();
                 auto& region = actor.getDimensionBlockSource();
                 auto  pos    = actor.getBlockPosCurrentlyStandingOn(&actor);
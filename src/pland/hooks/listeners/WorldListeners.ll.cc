@@ -18,6 +18,7 @@ void EventListener::registerLLWorldListeners() {
 
     RegisterListenerIf(Config::cfg.listeners.FireSpreadEvent, [&]() {
         return bus->emplaceListener<ll::event::FireSpreadEvent>([db](ll::event::FireSpreadEvent& ev) {
+            LD_TRACE_SPAN("FireSpreadEvent");
             auto& pos  = ev.pos();
             auto  land = db->getLandAt(pos, ev.blockSource().getDimensionId());
             if (PreCheckLandExistsAndPermission(land) || (land && land->getPermTable().allowFireSpread)) {
@@ -1,6 +1,8 @@
 #include "pland/infra/Config.h"
 #include "ll/api/Config.h"
 #include "pland/PLand.h"
+#include "pland/economy/PriceCalculate.h"
+#include "pland/land/LandCreateValidator.h"
 #include <filesystem>
 #include <string>
 #include <unordered_map>
@@ -19,6 +21,8 @@ bool Config::tryLoad() {
     }
 
     bool status = ll::config::loadConfig(Config::cfg, dir);
+    PriceCalculate::invalidateCache(); // 价格公式可能已变化
+    LandCreateValidator::rebuildForbiddenRangeIndex();
 
     return status ? status : trySave();
 }
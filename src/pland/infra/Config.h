@@ -17,7 +17,7 @@ struct ForbiddenRange {
 };
 
 struct Config {
-    int              version{23};
+    int              version{32};
     ll::io::LogLevel logLevel{ll::io::LogLevel::Info};
 
     EconomyConfig economy;
@@ -33,6 +33,38 @@ struct Config {
         bool setupDrawCommand{false}; // 安装领地绘制命令
         int  drawRange{64};           // 绘制 x 范围内的领地
 
+        // 内置粒子绘制(未安装 BSCI 时)
+        struct {
+            int viewDistance{64};             // 可视距离，超出此距离的边框不发送
+            int lodStep{16};                  // 距离每增加 lodStep 格，粒子间距 +1
+            int maxSpacing{8};                // 最大粒子间距
+            int maxPacketsPerTick{64};        // 每位玩家每 tick 最多发送的粒子包数量
+            int maxPacketsPerTickGlobal{512}; // 所有玩家每 tick 合计最多发送的粒子包数量
+        } particle;
+
+        // 安全传送
+        struct {
+            int maxConcurrentChunkLoads{4}; // 同时等待加载的目标区块数量上限(0 为不限制)，超出的传送任务排队
+        } teleport;
+
+        // 领地预写日志(WAL)
+        struct {
+            bool enabled{false};            // 是否启用，领地变更先写入日志，崩溃后启动时重放
+            int  groupCommitIntervalMs{20}; // 组提交间隔(毫秒)，间隔内的变更合并为一次写入
+            bool syncToDisk{false};         // 每次提交后是否同步到磁盘(更安全，但更慢)
+        } journal;
+
+        // 启动快照
+        struct {
+            bool enabled{false}; // 正常关服时写出领地快照，下次启动时映射加载，跳过数据库遍历与区块映射构建
+        } snapshot;
+
+        // 懒加载
+        struct {
+            bool enabled{false};        // 换出长时间未访问的领地名称、描述与成员，附近区块加载或玩家靠近时异步读取
+            int  evictAfterMinutes{10}; // 超过此时间(分钟)未访问的领地被换出
+        } lazyLoad;
+
         struct {
             bool   enabled{false};                              // 是否启用
             int    maxNested{5};                                // 最大嵌套层数(默认5，最大16)
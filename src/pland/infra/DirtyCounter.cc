@@ -16,5 +16,10 @@ void DirtyCounter::decrement() {
 
 void DirtyCounter::reset() { mCounter.store(0, std::memory_order_relaxed); }
 
+bool DirtyCounter::resetIfUnchanged(int counter) {
+    auto expected = static_cast<unsigned int>(counter);
+    return mCounter.compare_exchange_strong(expected, 0, std::memory_order_relaxed);
+}
+
 
 } // namespace land
\ No newline at end of file
@@ -20,6 +20,8 @@ class DirtyCounter {
     LDAPI void decrement(); // 减少计数器
 
     LDAPI void reset(); // 重置计数器
+
+    LDAPI bool resetIfUnchanged(int counter); // 计数器仍为 counter 时重置(期间有新的修改则保持脏状态)
 };
 
 } // namespace land
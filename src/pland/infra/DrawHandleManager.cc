@@ -1,9 +1,12 @@
 #include "pland/infra/DrawHandleManager.h"
+#include "ll/api/event/EventBus.h"
 #include "mc/world/actor/player/Player.h"
 #include "pland/PLand.h"
 #include "pland/infra/draw/IDrawHandle.h"
 #include "pland/infra/draw/impl/BSCIDrawHandle.h"
 #include "pland/infra/draw/impl/DefaultDrawHandle.h"
+#include "pland/land/LandEvent.h"
+#include <ranges>
 
 
 namespace land {
@@ -20,22 +23,33 @@ DrawHandleManager::DrawHandleManager() : mBsciAvailable(BsciDrawHandle::isBsciMo
                     "the built-in particle system!");
         logger.warn("[DrawHandleManager] BedrockServerClientInterface 模块未加载，插件将使用内置粒子系统!");
     }
+
+    // 领地范围变化后，增量刷新所有正在显示该领地的句柄
+    mLandRangeChangeListener = ll::event::EventBus::getInstance().emplaceListener<LandRangeChangeAfterEvent>(
+        [this](LandRangeChangeAfterEvent& ev) {
+            for (auto& [uuid, handle] : mDrawHandles) {
+                handle->refresh(ev.getLand());
+            }
+        }
+    );
 }
 
-DrawHandleManager::~DrawHandleManager() = default;
+DrawHandleManager::~DrawHandleManager() {
+    ll::event::EventBus::getInstance().removeListener(mLandRangeChangeListener);
+}
 
-std::unique_ptr<IDrawHandle> DrawHandleManager::createHandle() const {
+std::unique_ptr<IDrawHandle> DrawHandleManager::createHandle(Player& player) const {
     if (mBsciAvailable) {
         return std::make_unique<BsciDrawHandle>();
     } else {
-        return std::make_unique<DefaultDrawHandle>();
+        return std::make_unique<DefaultDrawHandle>(player.getUuid());
     }
 }
 
 IDrawHandle* DrawHandleManager::getOrCreateHandle(Player& player) {
     auto iter = mDrawHandles.find(player.getUuid());
     if (iter == mDrawHandles.end()) {
-        auto handle = createHandle();
+        auto handle = createHandle(player);
         iter        = mDrawHandles.emplace(player.getUuid(), std::move(handle)).first;
     }
     return iter->second.get();
@@ -45,5 +59,13 @@ void DrawHandleManager::removeHandle(Player& player) { mDrawHandles.erase(player
 
 void DrawHandleManager::removeAllHandle() { mDrawHandles.clear(); }
 
+MemoryUsage DrawHandleManager::estimateMemory() const {
+    MemoryUsage usage{"DrawHandleManager", mDrawHandles.size(), mem_utils::heapBytes(mDrawHandles)};
+    for (auto const& handle : mDrawHandles | std::views::values) {
+        usage.bytes += handle->estimateHeapBytes();
+    }
+    return usage;
+}
+
 
 } // namespace land
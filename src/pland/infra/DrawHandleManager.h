@@ -1,5 +1,7 @@
 #pragma once
+#include "ll/api/event/ListenerBase.h"
 #include "pland/Global.h"
+#include "pland/utils/MemoryEstimate.h"
 #include <memory>
 #include <unordered_map>
 
@@ -13,8 +15,9 @@ class IDrawHandle;
 class DrawHandleManager final {
     std::unordered_map<UUIDm, std::unique_ptr<IDrawHandle>> mDrawHandles;
     bool const                                              mBsciAvailable{false};
+    ll::event::ListenerPtr                                  mLandRangeChangeListener{nullptr};
 
-    std::unique_ptr<IDrawHandle> createHandle() const;
+    std::unique_ptr<IDrawHandle> createHandle(Player& player) const;
 
 public:
     LD_DISALLOW_COPY_AND_MOVE(DrawHandleManager);
@@ -27,6 +30,11 @@ class DrawHandleManager final {
     LDAPI void removeHandle(Player& player);
 
     LDAPI void removeAllHandle();
+
+    /**
+     * @brief 估算所有绘制句柄的内存占用
+     */
+    LDNDAPI MemoryUsage estimateMemory() const;
 };
 
 
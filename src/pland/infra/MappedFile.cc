@@ -0,0 +1,102 @@
+#include "pland/infra/MappedFile.h"
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace land {
+
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+#ifdef _WIN32
+        mFileHandle    = std::exchange(other.mFileHandle, nullptr);
+        mMappingHandle = std::exchange(other.mMappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::open(std::filesystem::path const& file) {
+    close();
+
+    std::error_code ec;
+    auto            size = std::filesystem::file_size(file, ec);
+    if (ec || size == 0) {
+        return false;
+    }
+
+#ifdef _WIN32
+    auto handle =
+        CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    auto mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(handle);
+        return false;
+    }
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(handle);
+        return false;
+    }
+    mFileHandle    = handle;
+    mMappingHandle = mapping;
+    mData          = static_cast<char const*>(view);
+#else
+    int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    auto view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // 映射建立后即可关闭
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    mData = static_cast<char const*>(view);
+#endif
+    mSize = static_cast<size_t>(size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (!mData) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(mData);
+    CloseHandle(mMappingHandle);
+    CloseHandle(mFileHandle);
+    mMappingHandle = nullptr;
+    mFileHandle    = nullptr;
+#else
+    ::munmap(const_cast<char*>(mData), mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+}
+
+bool MappedFile::isOpen() const { return mData != nullptr; }
+
+std::string_view MappedFile::data() const { return {mData, mSize}; }
+
+
+} // namespace land
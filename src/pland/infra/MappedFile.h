@@ -0,0 +1,45 @@
+#pragma once
+#include "pland/Global.h"
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+
+namespace land {
+
+
+/**
+ * @brief 只读内存映射文件
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    LDAPI ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    /**
+     * @brief 映射文件，文件不存在或为空时返回 false
+     */
+    LDNDAPI bool open(std::filesystem::path const& file);
+
+    LDAPI void close();
+
+    LDNDAPI bool isOpen() const;
+
+    LDNDAPI std::string_view data() const;
+
+private:
+    char const* mData{nullptr};
+    size_t      mSize{0};
+#ifdef _WIN32
+    void* mFileHandle{nullptr};
+    void* mMappingHandle{nullptr};
+#endif
+};
+
+
+} // namespace land
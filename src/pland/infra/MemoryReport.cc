@@ -0,0 +1,49 @@
+#include "pland/infra/MemoryReport.h"
+#include "fmt/format.h"
+#include "pland/PLand.h"
+#include "pland/infra/StartupProfiler.h"
+#include <string_view>
+
+
+namespace land {
+
+
+std::vector<MemoryUsage> MemoryReport::collect() {
+    auto& mod = PLand::getInstance();
+
+    std::vector<MemoryUsage> usages;
+    if (auto registry = mod.getLandRegistry()) {
+        usages = registry->estimateMemory();
+    }
+    if (auto manager = mod.getDrawHandleManager()) {
+        usages.push_back(manager->estimateMemory());
+    }
+    if (auto manager = mod.getSelectorManager()) {
+        usages.push_back(manager->estimateMemory());
+    }
+    return usages;
+}
+
+std::vector<std::string> MemoryReport::format(std::vector<MemoryUsage> const& usages) {
+    auto row = [](std::string_view name, std::string const& count, std::string const& memory) {
+        return fmt::format("{:<36} {:>10} {:>12}", name, count, memory);
+    };
+
+    std::vector<std::string> lines;
+    lines.reserve(usages.size() + 3);
+    lines.push_back(row("Structure", "Count", "Memory"));
+
+    size_t total = 0;
+    for (auto const& usage : usages) {
+        total += usage.bytes;
+        lines.push_back(row(usage.name, std::to_string(usage.count), mem_utils::formatBytes(usage.bytes)));
+    }
+    lines.push_back(row("Total (estimated)", "", mem_utils::formatBytes(total)));
+    if (auto process = StartupProfiler::getProcessMemory(); process > 0) {
+        lines.push_back(row("Process private memory", "", mem_utils::formatBytes(static_cast<size_t>(process))));
+    }
+    return lines;
+}
+
+
+} // namespace land
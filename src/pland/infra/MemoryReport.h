@@ -0,0 +1,32 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/utils/MemoryEstimate.h"
+#include <string>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 内存占用报告
+ * 汇总领地注册表、区块映射、家族索引、绘制句柄与选区的估算内存占用
+ */
+class MemoryReport {
+public:
+    MemoryReport() = delete;
+
+    /**
+     * @brief 收集各结构的内存占用
+     * @note 绘制句柄与选区非线程安全，需在主线程调用
+     */
+    LDNDAPI static std::vector<MemoryUsage> collect();
+
+    /**
+     * @brief 格式化为表格行，末尾附合计与进程私有内存
+     */
+    LDNDAPI static std::vector<std::string> format(std::vector<MemoryUsage> const& usages);
+};
+
+
+} // namespace land
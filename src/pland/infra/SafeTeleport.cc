@@ -1,23 +1,35 @@
 #include "SafeTeleport.h"
 #include "ll/api/chrono/GameChrono.h"
+#include "ll/api/event/EventBus.h"
+#include "ll/api/event/player/PlayerDestroyBlockEvent.h"
+#include "ll/api/event/player/PlayerPlaceBlockEvent.h"
 #include "ll/api/thread/ServerThreadExecutor.h"
 #include "mc/deps/ecs/WeakEntityRef.h"
 #include "mc/network/packet/SetTitlePacket.h"
 #include "mc/world/actor/player/Player.h"
 #include "pland/Global.h"
 #include "pland/PLand.h"
+#include "pland/infra/Config.h"
+#include "pland/infra/SpanTracer.h"
 #include "pland/utils/McUtils.h"
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <ll/api/coro/CoroTask.h>
 #include <ll/api/thread/ThreadPoolExecutor.h>
 #include <mc/deps/core/math/Vec3.h>
 #include <mc/deps/game_refs/WeakRef.h>
+#include <mc/world/level/BlockPos.h>
 #include <mc/world/level/BlockSource.h>
 #include <mc/world/level/block/Block.h>
+#include <mc/world/level/block/BlockLegacy.h>
 #include <mc/world/level/chunk/ChunkSource.h>
 #include <mc/world/level/chunk/ChunkState.h>
 #include <mc/world/level/chunk/LevelChunk.h>
 #include <mc/world/level/dimension/Dimension.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace land {
 
@@ -55,11 +67,10 @@ Player* SafeTeleport::Task::getPlayer() const { return mWeakPlayer.tryUnwrap<Pla
 
 void SafeTeleport::Task::updateState(TaskState state) { mState = state; }
 
-void SafeTeleport::Task::updateCounter() { mCounter++; }
-
 void SafeTeleport::Task::sendWaitChunkLoadTip() {
     if (auto player = getPlayer()) {
-        mTipPacket.mTitleText = "等待区块加载... ({}/{})"_trf(*player, mCounter, MaxCounter);
+        auto waited = std::chrono::duration_cast<std::chrono::seconds>(LatencyStats<>::Clock::now() - mChunkWaitAt);
+        mTipPacket.mTitleText = "等待区块加载... ({}/{})"_trf(*player, waited.count(), ChunkLoadTimeout.count());
         mTipPacket.sendTo(*player);
     }
 }
@@ -86,26 +97,21 @@ bool SafeTeleport::Task::isTargetChunkFullyLoaded() const {
     if (!dim) {
         return false;
     }
-    auto& chunkSource = dim->getChunkSource();
-    if (!chunkSource.isWithinWorldLimit(mTargetChunkPos)) return true;
-    auto chunk = chunkSource.getOrLoadChunk(mTargetChunkPos, ::ChunkSource::LoadMode::None, true);
-    return chunk && static_cast<int>(chunk->mLoadState->load()) >= static_cast<int>(ChunkState::Loaded)
-        && !chunk->mIsEmptyClientChunk && chunk->mIsRedstoneLoaded;
+    return SafeTeleport::isChunkFullyLoaded(*dim, mTargetChunkPos);
 }
 
-void SafeTeleport::Task::checkChunkStatus() {
-    if (isWaitingChunkLoad()) {
-        if (isTargetChunkFullyLoaded()) {
-            updateState(TaskState::ChunkLoaded);
-        } else if (mCounter > MaxCounter) {
-            updateState(TaskState::ChunkLoadTimeout);
-        } else {
-            updateCounter();
-            sendWaitChunkLoadTip();
-            teleportToTargetPosAndTryLoadChunk();
-        }
-    }
+SafeTeleport::ChunkKey SafeTeleport::Task::getChunkKey() const {
+    return {mTargetPos.second, mTargetChunkPos.x, mTargetChunkPos.z};
+}
+
+SafeTeleport::SearchKey SafeTeleport::Task::getSearchKey() const {
+    return {
+        mTargetPos.second,
+        static_cast<int>(std::floor(mTargetPos.first.x)),
+        static_cast<int>(std::floor(mTargetPos.first.z))
+    };
 }
+
 void SafeTeleport::Task::teleportToTargetPosAndTryLoadChunk() {
     if (auto player = getPlayer()) {
         player->teleport(mTargetPos.first, mTargetPos.second);
@@ -130,32 +136,68 @@ void SafeTeleport::Task::_tryApplyDimensionFixPatch(DimensionHeightRange const&
 void SafeTeleport::Task::_applyNetherFixPatch(DimensionHeightRange const& range) {
     mTargetPos.first.y = range.mMax - 5; // 向下偏移 5 格，避免基岩顶部
 }
-void SafeTeleport::Task::_findSafePos() {
-    static auto const dangerousBlocks =
-        std::unordered_set<std::string>{"minecraft:water", "minecraft:lava", "minecraft:fire"};
+bool SafeTeleport::Task::_isDangerousBlock(Block const& block) {
+    static auto const dangerousBlocks = std::unordered_set<std::string>{
+        "minecraft:water",
+        "minecraft:flowing_water",
+        "minecraft:lava",
+        "minecraft:flowing_lava",
+        "minecraft:fire",
+        "minecraft:soul_fire",
+        "minecraft:magma",
+        "minecraft:cactus",
+        "minecraft:powder_snow"
+    };
+    // 按 BlockLegacy 分类，每种方块类型只做一次名称匹配
+    static std::unordered_map<BlockLegacy const*, bool> classified;
+
+    auto const* legacy = &block.getLegacyBlock();
+    auto        iter   = classified.find(legacy);
+    if (iter == classified.end()) {
+        iter = classified.emplace(legacy, dangerousBlocks.contains(block.getTypeName())).first;
+    }
+    return iter->second;
+}
 
+void SafeTeleport::Task::_findSafePos() {
+    auto dimension = mTargetDimension.lock();
+    if (!dimension) {
+        updateState(TaskState::NoSafePos);
+        return;
+    }
     auto& targetPos   = mTargetPos.first;
-    auto* player      = getPlayer();
-    auto& blockSource = *mTargetDimension.lock()->mBlockSource.get();
+    auto& blockSource = *dimension->mBlockSource.get();
 
-    auto const& heightRange = player->getDimension().mHeightRange.get();
+    auto const& heightRange = dimension->mHeightRange.get();
     auto const  start       = heightRange.mMax;
     auto const  end         = heightRange.mMin;
 
-    Block* headBlock = nullptr; // 头部方块
-    Block* legBlock  = nullptr; // 腿部方块
+    Block const* headBlock = nullptr; // 头部方块
+    Block const* legBlock  = nullptr; // 腿部方块
 
     auto& y = targetPos.y;
     y       = start; // 从最高点开始寻找
 
     _tryApplyDimensionFixPatch(heightRange); // 尝试应用维度修复补丁
 
+    // 有天空的维度从高度图开始，高度图以上都是空气；下界等有顶棚的维度退回逐格扫描
+    if (y == start) {
+        auto height = static_cast<int>(blockSource.getHeightmap(
+            static_cast<int>(std::floor(targetPos.x)),
+            static_cast<int>(std::floor(targetPos.z))
+        ));
+        if (height > end && height + 2 < start) {
+            y = static_cast<float>(height + 2);
+        }
+    }
+
 #ifdef DEBUG
     auto& logger = land::PLand::getInstance().getSelf().getLogger();
+    int   reads  = 0;
 #endif
 
     while (y > end && !mAbortFlag.load()) {
-        auto block = &const_cast<Block&>(blockSource.getBlock(targetPos));
+        auto block = &blockSource.getBlock(targetPos);
 
         if (!headBlock && !legBlock) { // 第一次循环, 初始化
             headBlock = block;
@@ -163,16 +205,20 @@ void SafeTeleport::Task::_findSafePos() {
         }
 
 #ifdef DEBUG
+        ++reads;
         logger.debug("[TPR] Y: {}  Block: {}", y, block->getTypeName());
 #endif
 
-        if (!block->isAir() &&                                 // 落脚点不是空气
-            !dangerousBlocks.contains(block->getTypeName()) && // 落脚点不是危险方块
-            headBlock->isAir() &&                              // 头部方块是空气
-            legBlock->isAir()                                  // 腿部方块是空气
+        if (!block->isAir() &&            // 落脚点不是空气
+            !_isDangerousBlock(*block) && // 落脚点不是危险方块
+            headBlock->isAir() &&         // 头部方块是空气
+            legBlock->isAir()             // 腿部方块是空气
         ) {
             y++; // 往上一格，当前格为落脚点方块
 
+#ifdef DEBUG
+            logger.debug("[TPR] Found safe pos after {} block reads", reads);
+#endif
             updateState(TaskState::FoundSafePos); // 找到安全位置
             return;
         }
@@ -185,9 +231,11 @@ void SafeTeleport::Task::_findSafePos() {
 }
 
 void SafeTeleport::Task::launchFindPosTask() {
-    ll::coro::keepThis([this]() -> ll::coro::CoroTask<> {
+    // 持有任务所有权，避免任务在查找前被移除
+    ll::coro::keepThis([self = shared_from_this()]() -> ll::coro::CoroTask<> {
         co_await ll::chrono::ticks(1); // 等待 1_tick 再开始寻找安全位置
-        _findSafePos();
+        if (self->isAborted()) co_return;
+        self->_findSafePos();
         co_return;
     }).launch(ll::thread::ServerThreadExecutor::getDefault());
 }
@@ -197,9 +245,32 @@ SafeTeleport::SafeTeleport() {
     mInterruptableSleep = std::make_shared<ll::coro::InterruptableSleep>();
     mPollingAbortFlag   = std::make_shared<std::atomic_bool>(false);
 
+    // 方块变化时使附近的安全位置缓存失效
+    auto& bus             = ll::event::EventBus::getInstance();
+    mBlockDestroyListener = bus.emplaceListener<ll::event::PlayerDestroyBlockEvent>(
+        [this](ll::event::PlayerDestroyBlockEvent& ev) {
+            mSafePosCache.invalidate(ev.pos(), ev.self().getDimensionId().id);
+        },
+        ll::event::EventPriority::Lowest
+    );
+    mBlockPlacedListener = bus.emplaceListener<ll::event::PlayerPlacedBlockEvent>(
+        [this](ll::event::PlayerPlacedBlockEvent& ev) {
+            mSafePosCache.invalidate(ev.pos(), ev.self().getDimensionId().id);
+        },
+        ll::event::EventPriority::Lowest
+    );
+}
+
+void SafeTeleport::ensureDriver() {
+    if (mDriverRunning) {
+        return;
+    }
+    mDriverRunning = true;
+
+    // 仅在有任务时运行，任务全部结束后协程退出
     ll::coro::keepThis([this, sleep = mInterruptableSleep, abortFlag = mPollingAbortFlag]() -> ll::coro::CoroTask<> {
         while (!abortFlag->load()) {
-            co_await sleep->sleepFor(ll::chrono::ticks{10});
+            co_await sleep->sleepFor(ll::chrono::ticks{1});
             if (abortFlag->load()) break;
             try {
                 polling();
@@ -208,27 +279,268 @@ SafeTeleport::SafeTeleport() {
                     "An exception occurred while polling SafeTeleport tasks"
                 );
             }
+            if (mTasks.empty()) {
+                mDriverRunning = false;
+                break;
+            }
         }
         co_return;
     }).launch(ll::thread::ServerThreadExecutor::getDefault());
 }
 
+void SafeTeleport::watchChunk(SharedTask const& task) {
+    mChunkWatch[task->getChunkKey()].push_back(task->mId);
+    if (mChunkLoadHook == 0) {
+        mChunkLoadHook = ChunkLoadHook::subscribe([this](LandDimid dimId, int chunkX, int chunkZ) {
+            onChunkLoaded(dimId, chunkX, chunkZ);
+        });
+    }
+}
+
+void SafeTeleport::unwatchChunk(SharedTask const& task) {
+    auto iter = mChunkWatch.find(task->getChunkKey());
+    if (iter == mChunkWatch.end()) {
+        return;
+    }
+    std::erase(iter->second, task->mId);
+    if (iter->second.empty()) {
+        mChunkWatch.erase(iter);
+    }
+}
+
+void SafeTeleport::onChunkLoaded(LandDimid dimId, int chunkX, int chunkZ) {
+    auto iter = mChunkWatch.find({dimId, chunkX, chunkZ});
+    if (iter == mChunkWatch.end()) {
+        return;
+    }
+    // 同一区块的等待者一起唤醒，由下一次 polling 继续推进
+    for (auto id : iter->second) {
+        if (auto task = mTasks.find(id); task != mTasks.end() && task->second->isWaitingChunkLoad()) {
+            task->second->updateState(TaskState::ChunkLoaded);
+        }
+    }
+    mChunkWatch.erase(iter);
+}
+
+bool SafeTeleport::canWatchChunk(SharedTask const& task) const {
+    auto const limit = Config::cfg.land.teleport.maxConcurrentChunkLoads;
+    // 等待同一区块的任务共用一个名额
+    return limit <= 0 || mChunkWatch.size() < static_cast<size_t>(limit) || mChunkWatch.contains(task->getChunkKey());
+}
+
+void SafeTeleport::joinSearchGroup(SharedTask const& task) {
+    auto& group = mSearchGroups[task->getSearchKey()];
+    group.push_back(task->mId);
+    if (group.size() == 1) {
+        task->launchFindPosTask(); // 组长负责查找
+    }
+}
+
+void SafeTeleport::resolveSearchGroup(SharedTask const& task) {
+    auto iter = mSearchGroups.find(task->getSearchKey());
+    if (iter == mSearchGroups.end() || iter->second.front() != task->mId) {
+        return;
+    }
+    for (auto id : iter->second) {
+        auto member = mTasks.find(id);
+        if (id == task->mId || member == mTasks.end() || !member->second->isFindingSafePos()) {
+            continue;
+        }
+        member->second->mTargetPos.first.y = task->mTargetPos.first.y;
+        member->second->updateState(task->getState());
+    }
+    mSearchGroups.erase(iter);
+}
+
+void SafeTeleport::leaveSearchGroup(SharedTask const& task) {
+    auto iter = mSearchGroups.find(task->getSearchKey());
+    if (iter == mSearchGroups.end()) {
+        return;
+    }
+    auto& group    = iter->second;
+    bool  isLeader = group.front() == task->mId;
+    std::erase(group, task->mId);
+    if (group.empty()) {
+        mSearchGroups.erase(iter);
+        return;
+    }
+    if (isLeader) {
+        // 组长在查找结束前退出(如玩家离线)，由下一个组员重新查找
+        task->mAbortFlag.store(true);
+        mTasks.at(group.front())->launchFindPosTask();
+    }
+}
+
+std::vector<std::string> SafeTeleport::getLatencyReport() const {
+    return {
+        fmt::format(
+            "Pending tasks: {}, watched chunks: {}, search groups: {}",
+            mTasks.size(),
+            mChunkWatch.size(),
+            mSearchGroups.size()
+        ),
+        "Chunk wait : " + mChunkWaitLatency.summary(),
+        "Pos search : " + mSearchLatency.summary(),
+        "Total      : " + mTotalLatency.summary()
+    };
+}
+
 SafeTeleport::~SafeTeleport() {
+    auto& bus = ll::event::EventBus::getInstance();
+    bus.removeListener(mBlockDestroyListener);
+    bus.removeListener(mBlockPlacedListener);
+
     mPollingAbortFlag->store(true);
     mInterruptableSleep->interrupt(true);
     for (auto& task : mTasks | std::views::values) {
         task->abort();
     }
     mTasks.clear();
+    mChunkWatch.clear();
+    mSearchGroups.clear();
+    if (mChunkLoadHook != 0) {
+        ChunkLoadHook::unsubscribe(mChunkLoadHook);
+    }
 }
 
 
 void SafeTeleport::launchTask(Player& player, DimensionPos targetPos) {
     auto task = std::make_shared<Task>(player, targetPos);
     mTasks.emplace(task->mId, task);
+    ensureDriver();
+}
+
+void SafeTeleport::launchTask(Player& player, DimensionPos targetPos, LandID landId) {
+    if (auto cached = mSafePosCache.find(landId, targetPos)) {
+        auto dim = player.getLevel().getDimension(targetPos.second).lock();
+        // 失效监听只覆盖玩家放置/破坏方块(爆炸、活塞、流体等不会触发)，缓存必须在已加载的区块中重新验证；
+        // 区块未加载时无法验证，交给常规任务加载区块并查找
+        if (dim && isChunkFullyLoaded(*dim, ChunkPos(*cached))) {
+            if (isSafeStandPos(*dim, *cached)) {
+                mc_utils::sendText(player, "[4/4] 安全位置已找到，正在传送..."_trf(player));
+                player.teleport(*cached, targetPos.second);
+                mTotalLatency.record(0.0);
+                return;
+            }
+            mSafePosCache.invalidate(landId);
+        }
+    }
+
+    auto task     = std::make_shared<Task>(player, targetPos);
+    task->mLandId = landId;
+    mTasks.emplace(task->mId, task);
+    ensureDriver();
+}
+
+SafeTeleport::SafePosCache& SafeTeleport::getSafePosCache() { return mSafePosCache; }
+
+bool SafeTeleport::isChunkFullyLoaded(Dimension& dimension, ChunkPos const& chunkPos) {
+    auto& chunkSource = dimension.getChunkSource();
+    if (!chunkSource.isWithinWorldLimit(chunkPos)) return true;
+    auto chunk = chunkSource.getOrLoadChunk(chunkPos, ::ChunkSource::LoadMode::None, true);
+    return chunk && static_cast<int>(chunk->mLoadState->load()) >= static_cast<int>(ChunkState::Loaded)
+        && !chunk->mIsEmptyClientChunk && chunk->mIsRedstoneLoaded;
+}
+
+bool SafeTeleport::isSafeStandPos(Dimension& dimension, Vec3 const& pos) {
+    auto&    blockSource = *dimension.mBlockSource.get();
+    BlockPos feet{pos};
+
+    auto const& ground = blockSource.getBlock(BlockPos{feet.x, feet.y - 1, feet.z});
+    return !ground.isAir() && !Task::_isDangerousBlock(ground) && blockSource.getBlock(feet).isAir()
+        && blockSource.getBlock(BlockPos{feet.x, feet.y + 1, feet.z}).isAir();
+}
+
+
+// SafePosCache
+std::optional<Vec3> SafeTeleport::SafePosCache::find(LandID landId, DimensionPos const& target) {
+    ColumnKey key{landId, static_cast<int>(std::floor(target.first.x)), static_cast<int>(std::floor(target.first.z))};
+
+    auto iter = mEntries.find(key);
+    if (iter == mEntries.end()) {
+        return std::nullopt;
+    }
+    if (iter->second.dimId != target.second || iter->second.expireAt <= Clock::now()) {
+        _erase(key);
+        return std::nullopt;
+    }
+    return iter->second.pos;
+}
+
+void SafeTeleport::SafePosCache::put(LandID landId, DimensionPos const& target, Vec3 const& safePos) {
+    ColumnKey key{landId, static_cast<int>(std::floor(target.first.x)), static_cast<int>(std::floor(target.first.z))};
+    _erase(key);
+
+    mEntries.emplace(key, Entry{landId, target.second, safePos, Clock::now() + TTL});
+
+    BlockPos pos{safePos};
+    mChunkIndex[{target.second, pos.x >> 4, pos.z >> 4}].push_back(key);
+}
+
+void SafeTeleport::SafePosCache::invalidate(BlockPos const& pos, int dimId) {
+    if (mEntries.empty()) {
+        return;
+    }
+
+    std::vector<ColumnKey> expired;
+    for (int cx = (pos.x - InvalidateRadius) >> 4; cx <= (pos.x + InvalidateRadius) >> 4; ++cx) {
+        for (int cz = (pos.z - InvalidateRadius) >> 4; cz <= (pos.z + InvalidateRadius) >> 4; ++cz) {
+            auto iter = mChunkIndex.find({dimId, cx, cz});
+            if (iter == mChunkIndex.end()) {
+                continue;
+            }
+            for (auto const& key : iter->second) {
+                BlockPos safe{mEntries.at(key).pos};
+                if (std::abs(safe.x - pos.x) <= InvalidateRadius && std::abs(safe.z - pos.z) <= InvalidateRadius
+                    && std::abs(safe.y - pos.y) <= InvalidateRadius + 1) {
+                    expired.push_back(key);
+                }
+            }
+        }
+    }
+    for (auto const& key : expired) {
+        _erase(key);
+    }
+}
+
+void SafeTeleport::SafePosCache::invalidate(LandID landId) {
+    std::vector<ColumnKey> expired;
+    for (auto const& [key, entry] : mEntries) {
+        if (entry.landId == landId) {
+            expired.push_back(key);
+        }
+    }
+    for (auto const& key : expired) {
+        _erase(key);
+    }
+}
+
+void SafeTeleport::SafePosCache::clear() {
+    mEntries.clear();
+    mChunkIndex.clear();
+}
+
+void SafeTeleport::SafePosCache::_erase(ColumnKey const& key) {
+    auto iter = mEntries.find(key);
+    if (iter == mEntries.end()) {
+        return;
+    }
+
+    BlockPos pos{iter->second.pos};
+    ChunkKey chunk{iter->second.dimId, pos.x >> 4, pos.z >> 4};
+    if (auto idx = mChunkIndex.find(chunk); idx != mChunkIndex.end()) {
+        std::erase(idx->second, key);
+        if (idx->second.empty()) {
+            mChunkIndex.erase(idx);
+        }
+    }
+    mEntries.erase(iter);
 }
 
 void SafeTeleport::polling() {
+    LD_TRACE_SPAN("SafeTeleport::polling");
+    ++mTickCounter;
+
     auto iter = mTasks.begin();
 
     while (iter != mTasks.end()) {
@@ -261,26 +573,59 @@ void SafeTeleport::polling() {
             break;
         case TaskState::TaskCompleted:
         case TaskState::TaskFailed:
+            unwatchChunk(task);
+            leaveSearchGroup(task);
             iter = mTasks.erase(iter); // 任务完成或失败, 移除任务
-            break;
+            continue;
         }
 
         ++iter;
     }
+
+    // 没有等待中的区块时退订，不在通知回调中退订
+    if (mChunkWatch.empty() && mChunkLoadHook != 0) {
+        ChunkLoadHook::unsubscribe(mChunkLoadHook);
+        mChunkLoadHook = 0;
+    }
 }
 
 void SafeTeleport::handlePending(SharedTask& task) {
     auto& player = *task->getPlayer();
-    mc_utils::sendText(player, "[1/4] 任务已创建"_trf(player));
+    if (!task->mQueued) {
+        mc_utils::sendText(player, "[1/4] 任务已创建"_trf(player));
+    }
 
     if (task->isTargetChunkFullyLoaded()) {
         task->updateState(TaskState::ChunkLoaded);
-    } else {
-        task->updateState(TaskState::WaitingChunkLoad);
-        mc_utils::sendText(player, "[2/4] 目标区块未加载，等待目标区块加载..."_trf(player));
+        return;
     }
+    if (!canWatchChunk(task)) {
+        // 区块加载名额已满，留在 Pending 状态排队
+        if (!task->mQueued) {
+            task->mQueued = true;
+            mc_utils::sendText(player, "[2/4] 传送排队中，请稍候..."_trf(player));
+        }
+        return;
+    }
+    task->mQueued      = false;
+    task->mChunkWaitAt = LatencyStats<>::Clock::now();
+    task->updateState(TaskState::WaitingChunkLoad);
+    mc_utils::sendText(player, "[2/4] 目标区块未加载，等待目标区块加载..."_trf(player));
+    watchChunk(task);
+    task->teleportToTargetPosAndTryLoadChunk(); // 只请求一次加载，之后等待区块加载通知
+}
+void SafeTeleport::handleWaitingChunkLoad(SharedTask& task) {
+    // 区块就绪由 onChunkLoaded 推进；这里只负责提示与超时
+    if (LatencyStats<>::Clock::now() - task->mChunkWaitAt < Task::ChunkLoadTimeout) {
+        if (mTickCounter % 20 == 0) {
+            task->sendWaitChunkLoadTip();
+        }
+        return;
+    }
+    // 超时前再确认一次，避免错过监视开始前已完成的加载
+    unwatchChunk(task);
+    task->updateState(task->isTargetChunkFullyLoaded() ? TaskState::ChunkLoaded : TaskState::ChunkLoadTimeout);
 }
-void SafeTeleport::handleWaitingChunkLoad(SharedTask& task) { task->checkChunkStatus(); }
 void SafeTeleport::handleChunkLoadTimeout(SharedTask& task) {
     auto& player = *task->getPlayer();
     mc_utils::sendText(player, "[2/4] 目标区块加载超时，正在返回原位置..."_trf(player));
@@ -288,21 +633,32 @@ void SafeTeleport::handleChunkLoadTimeout(SharedTask& task) {
     task->updateState(TaskState::TaskFailed);
 }
 void SafeTeleport::handleChunkLoaded(SharedTask& task) {
+    task->mChunkReadyAt = LatencyStats<>::Clock::now();
+    mChunkWaitLatency.record(task->mCreatedAt, task->mChunkReadyAt);
+
     auto& player = *task->getPlayer();
     mc_utils::sendText(player, "[3/4] 区块已加载，正在寻找安全位置..."_trf(player));
-    task->launchFindPosTask();
     task->updateState(TaskState::FindingSafePos);
+    joinSearchGroup(task); // 同一目标列只查找一次
 }
 
 void SafeTeleport::handleFoundSafePos(SharedTask& task) {
+    resolveSearchGroup(task);
     auto& player = *task->getPlayer();
     mc_utils::sendText(player, "[4/4] 安全位置已找到，正在传送..."_trf(player));
+    mSearchLatency.record(task->mChunkReadyAt);
+    if (task->mLandId != -1) {
+        mSafePosCache.put(task->mLandId, task->mTargetPos, task->mTargetPos.first);
+    }
     task->commit();
+    mTotalLatency.record(task->mCreatedAt);
     task->updateState(TaskState::TaskCompleted);
 }
 void SafeTeleport::handleNoSafePos(SharedTask& task) {
+    resolveSearchGroup(task);
     auto& player = *task->getPlayer();
     mc_utils::sendText(player, "[3/4] 未找到安全位置，正在返回原位置..."_trf(player));
+    mSearchLatency.record(task->mChunkReadyAt);
     task->rollback();
     task->updateState(TaskState::TaskFailed);
 }
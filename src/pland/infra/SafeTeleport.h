@@ -2,16 +2,29 @@
 #include "mc/deps/core/math/Vec3.h"
 #include "mc/deps/ecs/WeakEntityRef.h"
 #include "pland/Global.h"
+#include "pland/hooks/ChunkLoadHook.h"
+#include "pland/utils/LatencyStats.h"
+#include <chrono>
 #include <cstdint>
 #include <ll/api/coro/CoroTask.h>
 #include <ll/api/coro/InterruptableSleep.h>
+#include <ll/api/event/ListenerBase.h>
 #include <ll/api/thread/ServerThreadExecutor.h>
 #include <mc/network/packet/SetTitlePacket.h>
 #include <mc/world/level/BlockSource.h>
 #include <mc/world/level/ChunkPos.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 
+class Block;
+class BlockPos;
+class Dimension;
 class DimensionHeightRange;
 namespace mce {
 class UUID;
@@ -29,12 +42,28 @@ class SafeTeleport {
 public:
     using TaskId       = std::uint64_t;
     using DimensionPos = std::pair<Vec3, int>;
+    using ChunkKey     = std::tuple<int, int, int>; // dimId, chunkX, chunkZ
+    using SearchKey    = std::tuple<int, int, int>; // dimId, x, z (目标列)
+
+    struct TupleHash {
+        template <typename... Ts>
+        size_t operator()(std::tuple<Ts...> const& t) const {
+            size_t seed = 0;
+            std::apply(
+                [&](auto const&... v) {
+                    ((seed ^= std::hash<std::decay_t<decltype(v)>>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+                },
+                t
+            );
+            return seed;
+        }
+    };
 
     enum class TaskState {
         // 初始状态
         Pending, // 任务刚创建，等待开始处理
 
-        // 区块加载阶段（轮询检查）
+        // 区块加载阶段（由区块加载通知推进）
         WaitingChunkLoad, // 等待区块加载
         ChunkLoadTimeout, // 区块加载超时
         ChunkLoaded,      // 区块加载完成
@@ -49,22 +78,27 @@ class SafeTeleport {
         TaskFailed     // 任务失败（最终状态）
     };
 
-    class Task {
-        static inline constexpr short MaxCounter = 64;                                  // 最大计数器值
-        TaskId const                  mId;                                              // 任务ID
-        WeakRef<EntityContext>        mWeakPlayer;                                      // 玩家
-        WeakRef<Dimension>            mTargetDimension;                                 // 目标维度
-        ChunkPos                      mTargetChunkPos;                                  // 目标区块位置
-        DimensionPos const            mSourcePos;                                       // 原位置
-        DimensionPos                  mTargetPos;                                       // 目标位置
-        TaskState                     mState{TaskState::Pending};                       // 任务状态
-        short                         mCounter{0};                                      // 计数器
-        SetTitlePacket                mTipPacket{SetTitlePacket::TitleType::Actionbar}; // 提示包
-        std::atomic<bool>             mAbortFlag{false};                                // 终止标志
-
-        void _findSafePos();
-        void _tryApplyDimensionFixPatch(DimensionHeightRange const& range); // 尝试应用维度修复补丁
-        void _applyNetherFixPatch(DimensionHeightRange const& range);
+    class Task : public std::enable_shared_from_this<Task> {
+        static inline constexpr auto      ChunkLoadTimeout = std::chrono::seconds{30};      // 等待区块加载的超时时间
+        TaskId const                      mId;                                              // 任务ID
+        WeakRef<EntityContext>            mWeakPlayer;                                      // 玩家
+        WeakRef<Dimension>                mTargetDimension;                                 // 目标维度
+        ChunkPos                          mTargetChunkPos;                                  // 目标区块位置
+        DimensionPos const                mSourcePos;                                       // 原位置
+        DimensionPos                      mTargetPos;                                       // 目标位置
+        LandID                            mLandId{-1};                                      // 目标领地(用于缓存)
+        TaskState                         mState{TaskState::Pending};                       // 任务状态
+        bool                              mQueued{false};                                   // 是否正在排队等待区块加载名额
+        SetTitlePacket                    mTipPacket{SetTitlePacket::TitleType::Actionbar}; // 提示包
+        std::atomic<bool>                 mAbortFlag{false};                                // 终止标志
+        LatencyStats<>::Clock::time_point mCreatedAt{LatencyStats<>::Clock::now()};         // 创建时间
+        LatencyStats<>::Clock::time_point mChunkWaitAt{};                                   // 开始等待区块的时间
+        LatencyStats<>::Clock::time_point mChunkReadyAt{};                                  // 区块就绪时间
+
+        void        _findSafePos();
+        static bool _isDangerousBlock(Block const& block);                         // 落脚点是否为危险方块
+        void        _tryApplyDimensionFixPatch(DimensionHeightRange const& range); // 尝试应用维度修复补丁
+        void        _applyNetherFixPatch(DimensionHeightRange const& range);
         friend SafeTeleport;
 
     public:
@@ -89,15 +123,17 @@ class SafeTeleport {
 
         LDNDAPI bool isTargetChunkFullyLoaded() const;
 
+        LDNDAPI ChunkKey getChunkKey() const;
+
+        LDNDAPI SearchKey getSearchKey() const;
+
         LDNDAPI TaskState getState() const;
 
         LDNDAPI Player* getPlayer() const;
 
         LDAPI void updateState(TaskState state);
 
-        LDAPI void updateCounter();
-
-        LDAPI void sendWaitChunkLoadTip();
+        LDAPI void sendWaitChunkLoadTip(); // 显示已等待的秒数
 
         LDAPI void abort();
 
@@ -105,21 +141,89 @@ class SafeTeleport {
 
         LDAPI void commit() const;
 
-        LDAPI void checkChunkStatus();                   // 检查目标区块状态
         LDAPI void checkPlayerStatus();                  // 检查玩家是否在线
-        LDAPI void teleportToTargetPosAndTryLoadChunk(); // 传送到目标位置并尝试加载区块
+        LDAPI void teleportToTargetPosAndTryLoadChunk(); // 传送到目标位置以加载区块(每个任务只请求一次)
         LDAPI void launchFindPosTask();
     };
     using SharedTask = std::shared_ptr<Task>;
 
+    /**
+     * @brief 领地安全传送点缓存
+     * (LandID, 目标列) => 已验证的安全位置，TTL 过期或附近方块变化时失效
+     */
+    class SafePosCache {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr auto TTL              = std::chrono::minutes(5); // 缓存有效期
+        static constexpr int  InvalidateRadius = 2;                       // 方块变化时的失效半径
+
+        struct Entry {
+            LandID            landId;
+            int               dimId;
+            Vec3              pos; // 安全位置(脚部)
+            Clock::time_point expireAt;
+        };
+
+        LDNDAPI std::optional<Vec3> find(LandID landId, DimensionPos const& target);
+
+        LDAPI void put(LandID landId, DimensionPos const& target, Vec3 const& safePos);
+
+        LDAPI void invalidate(BlockPos const& pos, int dimId); // 方块变化
+
+        LDAPI void invalidate(LandID landId);
+
+        LDAPI void clear();
+
+    private:
+        using ColumnKey = std::tuple<LandID, int, int>; // landId, x, z
+
+        void _erase(ColumnKey const& key);
+
+        std::unordered_map<ColumnKey, Entry, TupleHash>                 mEntries;
+        std::unordered_map<ChunkKey, std::vector<ColumnKey>, TupleHash> mChunkIndex; // 区块 => 落在其中的缓存
+    };
+
     LDAPI explicit SafeTeleport();
     LDAPI ~SafeTeleport();
 
     LDAPI void launchTask(Player& player, DimensionPos targetPos);
 
+    /**
+     * @brief 传送到领地
+     * @note 命中安全位置缓存、所在区块已加载且验证通过时直接传送，跳过安全位置查找
+     */
+    LDAPI void launchTask(Player& player, DimensionPos targetPos, LandID landId);
+
+    LDNDAPI SafePosCache& getSafePosCache();
+
+    /**
+     * @brief 目标区块是否已完整加载
+     */
+    LDNDAPI static bool isChunkFullyLoaded(Dimension& dimension, ChunkPos const& chunkPos);
+
+    /**
+     * @brief 快速验证落脚点是否仍然安全(脚下为非危险实体方块，脚部与头部为空气)
+     */
+    LDNDAPI static bool isSafeStandPos(Dimension& dimension, Vec3 const& pos);
+
+    /**
+     * @brief 传送流程各阶段的延迟分位数
+     */
+    LDNDAPI std::vector<std::string> getLatencyReport() const;
+
 
 private:
-    void polling(); // 轮询任务状态
+    void polling();                                              // 推进任务状态(仅在有任务时运行)
+    void ensureDriver();                                         // 有任务时启动驱动协程
+    void watchChunk(SharedTask const& task);                     // 等待区块加载通知(有等待时才订阅)
+    void unwatchChunk(SharedTask const& task);                   // 任务结束时移出等待列表
+    void onChunkLoaded(LandDimid dimId, int chunkX, int chunkZ); // 唤醒等待该区块的任务
+    bool canWatchChunk(SharedTask const& task) const;            // 是否还有区块加载名额
+
+    void joinSearchGroup(SharedTask const& task);    // 加入同一目标列的查找组，组内只有首个任务真正查找
+    void resolveSearchGroup(SharedTask const& task); // 组长查找结束，将结果同步给组员
+    void leaveSearchGroup(SharedTask const& task);   // 任务结束，组长提前退出时由组员接替
 
     void handlePending(SharedTask& task);
     void handleWaitingChunkLoad(SharedTask& task);
@@ -128,7 +232,18 @@ class SafeTeleport {
     void handleFoundSafePos(SharedTask& task);
     void handleNoSafePos(SharedTask& task);
 
-    std::unordered_map<TaskId, SharedTask> mTasks;
+    std::unordered_map<TaskId, SharedTask>                        mTasks;
+    std::unordered_map<ChunkKey, std::vector<TaskId>, TupleHash>  mChunkWatch;       // 区块 => 等待该区块的任务
+    std::unordered_map<SearchKey, std::vector<TaskId>, TupleHash> mSearchGroups;     // 目标列 => 查找组(首个为组长)
+    SafePosCache                                                  mSafePosCache;
+    ll::event::ListenerPtr                                        mBlockDestroyListener{nullptr};
+    ll::event::ListenerPtr                                        mBlockPlacedListener{nullptr};
+    ChunkLoadHook::Handle                                         mChunkLoadHook{0}; // 区块加载通知(无等待时为 0)
+    bool                                                          mDriverRunning{false};
+    uint64_t                                                      mTickCounter{0};
+    LatencyStats<>                                                mChunkWaitLatency; // 创建 => 区块就绪
+    LatencyStats<>                                                mSearchLatency;    // 区块就绪 => 找到位置
+    LatencyStats<>                                                mTotalLatency;     // 创建 => 传送完成
 
     std::shared_ptr<ll::coro::InterruptableSleep> mInterruptableSleep{nullptr};
     std::shared_ptr<std::atomic_bool>             mPollingAbortFlag{nullptr};
@@ -0,0 +1,158 @@
+#include "pland/infra/SpanTracer.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+namespace land {
+
+
+namespace {
+
+struct SpanRecord {
+    char const* name{nullptr};
+    int64_t     beginNs{0}; // 相对于 start 的时间
+    int64_t     durNs{0};
+};
+
+struct ThreadBuffer {
+    std::mutex              mutex; // 仅在写入与导出时竞争
+    std::vector<SpanRecord> records;
+    size_t                  head{0};
+    size_t                  size{0};
+    size_t                  overwritten{0};
+    uint32_t                tid{0};
+    std::thread::id         threadId;
+};
+
+std::atomic<int64_t>                       gOriginNs{0}; // start 时的 Clock 时间
+std::mutex                                 gBuffersMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> gBuffers; // 线程退出后仍保留，便于导出
+std::thread::id                            gStartThread;
+uint32_t                                   gNextTid{1};
+
+ThreadBuffer& localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+        auto ptr      = std::make_shared<ThreadBuffer>();
+        ptr->threadId = std::this_thread::get_id();
+
+        std::lock_guard lock(gBuffersMutex);
+        ptr->tid = gNextTid++;
+        gBuffers.push_back(ptr);
+        return ptr;
+    }();
+    return *buffer;
+}
+
+int64_t toNs(SpanTracer::Clock::time_point tp) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+
+} // namespace
+
+
+bool SpanTracer::start() {
+    std::lock_guard lock(gBuffersMutex);
+    if (sRunning.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    for (auto& buffer : gBuffers) {
+        std::lock_guard bufferLock(buffer->mutex);
+        buffer->head        = 0;
+        buffer->size        = 0;
+        buffer->overwritten = 0;
+    }
+    gStartThread = std::this_thread::get_id();
+    gOriginNs.store(toNs(Clock::now()), std::memory_order_relaxed);
+    sRunning.store(true, std::memory_order_release);
+    return true;
+}
+
+void SpanTracer::record(char const* name, Clock::time_point begin, Clock::time_point end) {
+    auto beginNs = toNs(begin) - gOriginNs.load(std::memory_order_relaxed);
+    if (beginNs < 0 || !isRunning()) {
+        return; // 跨越 start / stop 的 Span
+    }
+
+    auto&           buffer = localBuffer();
+    std::lock_guard lock(buffer.mutex);
+    if (buffer.records.empty()) {
+        buffer.records.resize(BufferCapacity); // 首次记录时才分配
+    }
+    buffer.records[buffer.head] = SpanRecord{name, beginNs, toNs(end) - toNs(begin)};
+    buffer.head                 = (buffer.head + 1) % BufferCapacity;
+    if (buffer.size < BufferCapacity) {
+        ++buffer.size;
+    } else {
+        ++buffer.overwritten;
+    }
+}
+
+std::optional<SpanTracer::Summary> SpanTracer::stop(std::filesystem::path const& file) {
+    std::lock_guard lock(gBuffersMutex);
+    if (!sRunning.exchange(false)) {
+        return std::nullopt;
+    }
+
+    // Chrome Trace Event Format: 线程名为元数据事件(ph = M)，Span 为完整事件(ph = X)，时间单位为微秒
+    Summary     summary;
+    std::string out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+    auto        it  = std::back_inserter(out);
+    bool        first{true};
+    for (auto& buffer : gBuffers) {
+        std::lock_guard bufferLock(buffer->mutex);
+        if (buffer->size == 0) {
+            continue;
+        }
+        ++summary.threads;
+        summary.spans       += buffer->size;
+        summary.overwritten += buffer->overwritten;
+
+        fmt::format_to(
+            it,
+            R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+            first ? "" : ",",
+            buffer->tid,
+            buffer->threadId == gStartThread ? std::string{"Server thread"} : fmt::format("Thread {}", buffer->tid)
+        );
+        first = false;
+
+        size_t begin = (buffer->head + BufferCapacity - buffer->size) % BufferCapacity;
+        for (size_t i = 0; i < buffer->size; ++i) {
+            auto const& rec = buffer->records[(begin + i) % BufferCapacity];
+            fmt::format_to(
+                it,
+                R"(,{{"name":"{}","cat":"pland","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{}}})",
+                rec.name,
+                static_cast<double>(rec.beginNs) / 1000.0,
+                static_cast<double>(rec.durNs) / 1000.0,
+                buffer->tid
+            );
+        }
+    }
+    out += "]}";
+
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    std::ofstream ofs(file, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+        return std::nullopt;
+    }
+    ofs.write(out.data(), static_cast<std::streamsize>(out.size()));
+    if (!ofs) {
+        return std::nullopt;
+    }
+    return summary;
+}
+
+
+} // namespace land
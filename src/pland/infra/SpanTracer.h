@@ -0,0 +1,83 @@
+#pragma once
+#include "pland/Global.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+
+
+namespace land {
+
+
+/**
+ * @brief 作用域耗时追踪
+ * 每个线程写入各自的环形缓冲区(只保留最近 BufferCapacity 个 Span)，
+ * 停止后合并写出 Chrome Trace JSON，可在 Perfetto / chrome://tracing 中打开
+ *
+ * 编译期由 LD_SPAN_TRACE 控制是否插桩(见 LD_TRACE_SPAN)，运行期由 start / stop 开关；
+ * 未开启时每个 Span 只有一次原子读取
+ */
+class SpanTracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t BufferCapacity = 1 << 16; // 每线程缓冲区容量
+
+    /**
+     * @brief 作用域 Span，构造时开始、析构时结束
+     * @param name 必须是字符串字面量(只保存指针)
+     */
+    class Span {
+        char const*       mName;
+        Clock::time_point mBegin{};
+        bool              mActive;
+
+    public:
+        explicit Span(char const* name) : mName(name), mActive(isRunning()) {
+            if (mActive) mBegin = Clock::now();
+        }
+        ~Span() {
+            if (mActive) record(mName, mBegin, Clock::now());
+        }
+
+        LD_DISALLOW_COPY_AND_MOVE(Span);
+    };
+
+    struct Summary {
+        size_t spans{0};       // 写出的 Span 数
+        size_t overwritten{0}; // 因缓冲区已满被覆盖的 Span 数
+        size_t threads{0};     // 记录到 Span 的线程数
+    };
+
+    [[nodiscard]] static bool isRunning() { return sRunning.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 开始记录，清空之前的缓冲区
+     * @return 已在记录中时返回 false
+     */
+    LDAPI static bool start();
+
+    /**
+     * @brief 停止记录并写出 Chrome Trace 文件
+     * @return 未在记录中或写入失败时返回 std::nullopt
+     */
+    LDAPI static std::optional<Summary> stop(std::filesystem::path const& file);
+
+private:
+    static inline std::atomic<bool> sRunning{false}; // 头文件内联读取，Span 构造不经过导出函数
+
+    LDAPI static void record(char const* name, Clock::time_point begin, Clock::time_point end);
+};
+
+
+} // namespace land
+
+
+#ifdef LD_SPAN_TRACE
+#define LD_TRACE_SPAN_CONCAT_IMPL(A, B) A##B
+#define LD_TRACE_SPAN_CONCAT(A, B)      LD_TRACE_SPAN_CONCAT_IMPL(A, B)
+#define LD_TRACE_SPAN(NAME)             ::land::SpanTracer::Span LD_TRACE_SPAN_CONCAT(_ldTraceSpan, __LINE__)(NAME)
+#else
+#define LD_TRACE_SPAN(NAME) ((void)0)
+#endif
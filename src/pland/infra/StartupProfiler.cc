@@ -0,0 +1,132 @@
+#include "pland/infra/StartupProfiler.h"
+#include "nlohmann/json.hpp"
+#include "pland/PLand.h"
+#include <fstream>
+#include <system_error>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <psapi.h>
+#endif
+
+
+namespace land {
+
+
+StartupProfiler& StartupProfiler::getInstance() {
+    static StartupProfiler instance;
+    return instance;
+}
+
+StartupProfiler::StartupProfiler() : mOrigin(Clock::now()) {}
+
+int64_t StartupProfiler::getProcessMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS_EX counters{};
+    if (GetProcessMemoryInfo(
+            GetCurrentProcess(),
+            reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+            sizeof(counters)
+        )) {
+        return static_cast<int64_t>(counters.PrivateUsage);
+    }
+#endif
+    return 0;
+}
+
+StartupProfiler::Scope StartupProfiler::phase(std::string name) {
+    if (mFinished) {
+        return Scope{*this, SIZE_MAX};
+    }
+    Phase phase{};
+    phase.name     = std::move(name);
+    phase.depth    = mDepth++;
+    phase.memBegin = getProcessMemory();
+    phase.begin    = Clock::now();
+    mPhases.push_back(std::move(phase));
+    return Scope{*this, mPhases.size() - 1};
+}
+
+void StartupProfiler::endPhase(size_t index) {
+    if (index >= mPhases.size()) {
+        return;
+    }
+    auto& phase = mPhases[index];
+    if (phase.closed) {
+        return;
+    }
+    phase.ms       = std::chrono::duration<double, std::milli>(Clock::now() - phase.begin).count();
+    phase.memDelta = getProcessMemory() - phase.memBegin;
+    phase.closed   = true;
+    if (mDepth > 0) --mDepth;
+}
+
+std::vector<StartupProfiler::Phase> const& StartupProfiler::getPhases() const { return mPhases; }
+
+void StartupProfiler::finish(std::filesystem::path const& traceFile) {
+    if (mFinished) {
+        return;
+    }
+    mFinished = true;
+
+    logTable();
+
+    auto& logger = PLand::getInstance().getSelf().getLogger();
+    if (writeChromeTrace(traceFile)) {
+        logger.debug("Startup trace written to {}", traceFile.string());
+    } else {
+        logger.warn("Failed to write startup trace: {}", traceFile.string());
+    }
+}
+
+void StartupProfiler::logTable() const {
+    auto& logger = PLand::getInstance().getSelf().getLogger();
+
+    double total = 0;
+    for (auto const& phase : mPhases) {
+        if (phase.depth == 0) total += phase.ms;
+    }
+    logger.info("启动耗时 {:.1f} ms，各阶段:", total);
+    logger.info("{:<36} {:>10} {:>12}", "Phase", "Time(ms)", "Memory(KiB)");
+    for (auto const& phase : mPhases) {
+        auto name = std::string(phase.depth * 2, ' ') + phase.name;
+        logger.info("{:<36} {:>10.2f} {:>+12}", name, phase.ms, phase.memDelta / 1024);
+    }
+}
+
+bool StartupProfiler::writeChromeTrace(std::filesystem::path const& file) const {
+    // Chrome Trace Event Format，每个阶段为一个完整事件(ph = X)，时间单位为微秒
+    auto events = nlohmann::json::array();
+    for (auto const& phase : mPhases) {
+        if (!phase.closed) continue;
+        nlohmann::json event;
+        event["name"] = phase.name;
+        event["cat"]  = "startup";
+        event["ph"]   = "X";
+        event["ts"]   = std::chrono::duration<double, std::micro>(phase.begin - mOrigin).count();
+        event["dur"]  = phase.ms * 1000.0;
+        event["pid"]  = 1;
+        event["tid"]  = 1;
+        event["args"] = {
+            {"memoryDeltaBytes", phase.memDelta                 },
+            {"memoryBytes",      phase.memBegin + phase.memDelta}
+        };
+        events.push_back(std::move(event));
+    }
+    nlohmann::json root{
+        {"traceEvents",     std::move(events)},
+        {"displayTimeUnit", "ms"             }
+    };
+
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    std::ofstream ofs(file, std::ios::trunc);
+    if (!ofs) {
+        return false;
+    }
+    ofs << root.dump(2);
+    return static_cast<bool>(ofs);
+}
+
+
+} // namespace land
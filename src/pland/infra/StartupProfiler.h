@@ -0,0 +1,95 @@
+#pragma once
+#include "pland/Global.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 启动阶段分析器
+ * 记录 PLand::load / enable 中每个阶段的耗时与进程内存变化，
+ * 启动完成后输出表格到日志，并写出 Chrome Trace 格式的 JSON (chrome://tracing / Perfetto 可直接打开)
+ * @note 仅在主线程使用，非线程安全
+ */
+class StartupProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string       name;
+        size_t            depth{0};    // 嵌套深度
+        Clock::time_point begin{};     // 开始时间
+        double            ms{0};       // 耗时(毫秒)
+        int64_t           memBegin{0}; // 开始时的进程私有内存(字节)
+        int64_t           memDelta{0}; // 内存变化(字节)
+        bool              closed{false};
+    };
+
+    /**
+     * @brief 阶段作用域，析构时结束阶段
+     */
+    class Scope {
+        StartupProfiler* mProfiler{nullptr};
+        size_t           mIndex{0};
+
+    public:
+        Scope(StartupProfiler& profiler, size_t index) : mProfiler(&profiler), mIndex(index) {}
+        ~Scope() { end(); }
+
+        /**
+         * @brief 提前结束阶段
+         */
+        void end() {
+            if (mProfiler) mProfiler->endPhase(mIndex);
+            mProfiler = nullptr;
+        }
+
+        Scope(Scope&& other) noexcept : mProfiler(other.mProfiler), mIndex(other.mIndex) { other.mProfiler = nullptr; }
+        Scope(Scope const&)            = delete;
+        Scope& operator=(Scope const&) = delete;
+        Scope& operator=(Scope&&)      = delete;
+    };
+
+    LDNDAPI static StartupProfiler& getInstance();
+
+    /**
+     * @brief 开始一个阶段，返回的作用域析构时结束
+     * @note 在 finish 之后调用不会记录
+     */
+    LDNDAPI Scope phase(std::string name);
+
+    /**
+     * @brief 结束记录，输出表格到日志并写出 Chrome Trace 文件
+     * @param traceFile Chrome Trace 文件路径
+     */
+    LDAPI void finish(std::filesystem::path const& traceFile);
+
+    LDNDAPI std::vector<Phase> const& getPhases() const;
+
+    /**
+     * @brief 当前进程私有内存(字节)，非 Windows 平台返回 0
+     */
+    LDNDAPI static int64_t getProcessMemory();
+
+private:
+    StartupProfiler();
+
+    void endPhase(size_t index);
+
+    void logTable() const;
+    bool writeChromeTrace(std::filesystem::path const& file) const;
+
+    Clock::time_point  mOrigin;
+    std::vector<Phase> mPhases;
+    size_t             mDepth{0};
+    bool               mFinished{false};
+};
+
+
+} // namespace land
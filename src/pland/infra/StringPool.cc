@@ -0,0 +1,88 @@
+#include "pland/infra/StringPool.h"
+
+
+namespace land {
+
+
+InternedString::InternedString(std::string_view value)
+: mEntry(value.empty() ? nullptr : StringPool::getInstance().acquire(value)) {}
+
+InternedString::InternedString(InternedString const& other) : mEntry(other.mEntry) {
+    if (mEntry) mEntry->refs.fetch_add(1, std::memory_order_relaxed); // other 仍持有引用，条目不会被移除
+}
+
+InternedString& InternedString::operator=(InternedString const& other) {
+    if (this != &other) {
+        InternedString copy{other};
+        std::swap(mEntry, copy.mEntry);
+    }
+    return *this;
+}
+
+InternedString::InternedString(InternedString&& other) noexcept : mEntry(std::exchange(other.mEntry, nullptr)) {}
+
+InternedString& InternedString::operator=(InternedString&& other) noexcept {
+    if (this != &other) {
+        InternedString old{std::move(*this)};
+        mEntry = std::exchange(other.mEntry, nullptr);
+    }
+    return *this;
+}
+
+InternedString::~InternedString() {
+    if (mEntry) StringPool::getInstance().release(mEntry);
+}
+
+std::string const& InternedString::str() const {
+    static std::string const empty;
+    return mEntry ? mEntry->value : empty;
+}
+
+bool InternedString::empty() const { return mEntry == nullptr; }
+
+
+StringPool& StringPool::getInstance() {
+    static StringPool instance;
+    return instance;
+}
+
+InternedString::Entry* StringPool::acquire(std::string_view value) {
+    std::lock_guard lock(mMutex);
+    auto            iter = mEntries.find(value);
+    if (iter == mEntries.end()) {
+        auto entry   = std::make_unique<InternedString::Entry>();
+        entry->value = std::string{value};
+        auto key     = std::string_view{entry->value};
+        iter         = mEntries.emplace(key, std::move(entry)).first;
+    }
+    iter->second->refs.fetch_add(1, std::memory_order_relaxed);
+    return iter->second.get();
+}
+
+void StringPool::release(InternedString::Entry* entry) {
+    // 引用数大于 1 时无需加锁；可能降为 0 时在锁内递减，避免与 acquire 竞争
+    auto refs = entry->refs.load(std::memory_order_relaxed);
+    while (refs > 1) {
+        if (entry->refs.compare_exchange_weak(refs, refs - 1, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+    std::lock_guard lock(mMutex);
+    if (entry->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        mEntries.erase(std::string_view{entry->value});
+    }
+}
+
+MemoryUsage StringPool::estimateMemory() const {
+    std::lock_guard lock(mMutex);
+
+    MemoryUsage usage{"StringPool", mEntries.size()};
+    usage.bytes = mem_utils::heapBytes(mEntries);
+    for (auto const& entry : mEntries) {
+        usage.bytes += sizeof(InternedString::Entry) + mem_utils::heapBytes(entry.second->value);
+    }
+    return usage;
+}
+
+
+} // namespace land
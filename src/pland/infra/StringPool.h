@@ -0,0 +1,80 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/utils/MemoryEstimate.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+
+namespace land {
+
+
+class StringPool;
+
+/**
+ * @brief 驻留字符串句柄
+ * 相同内容的字符串在 StringPool 中只保存一份，句柄只占一个指针；
+ * 句柄指向的内容不可修改，赋新值时改为指向另一个条目(写时复制)，最后一个句柄释放时条目从池中移除
+ */
+class InternedString {
+public:
+    struct Entry {
+        std::string           value;
+        std::atomic<uint32_t> refs{0};
+    };
+
+    InternedString() = default;
+    LDAPI explicit InternedString(std::string_view value);
+    LDAPI InternedString(InternedString const& other);
+    LDAPI InternedString& operator=(InternedString const& other);
+    LDAPI InternedString(InternedString&& other) noexcept;
+    LDAPI InternedString& operator=(InternedString&& other) noexcept;
+    LDAPI ~InternedString();
+
+    LDNDAPI std::string const& str() const; // 仅在句柄被重新赋值或析构前有效
+
+    LDNDAPI bool empty() const;
+
+    // 同一个池中内容相同即为同一条目
+    bool operator==(InternedString const& other) const { return mEntry == other.mEntry; }
+    bool operator==(std::string_view other) const { return str() == other; }
+
+private:
+    Entry* mEntry{nullptr}; // 空字符串不占用条目
+};
+
+
+/**
+ * @brief 字符串驻留池(线程安全)
+ * 用于领地主人、名称、描述等大量重复的文本
+ */
+class StringPool {
+public:
+    LD_DISALLOW_COPY_AND_MOVE(StringPool);
+
+    LDNDAPI static StringPool& getInstance();
+
+    /**
+     * @brief 估算驻留池的内存占用，count 为条目数
+     */
+    LDNDAPI MemoryUsage estimateMemory() const;
+
+private:
+    StringPool() = default;
+
+    friend InternedString;
+
+    InternedString::Entry* acquire(std::string_view value);
+    void                   release(InternedString::Entry* entry);
+
+    mutable std::mutex                                                           mMutex;
+    std::unordered_map<std::string_view, std::unique_ptr<InternedString::Entry>> mEntries; // 键指向条目自身的字符串
+};
+
+
+} // namespace land
@@ -33,6 +33,17 @@ class IDrawHandle {
 
     virtual void draw(std::shared_ptr<Land> const& land, mce::Color const& color) = 0;
 
+    /**
+     * @brief 更新已绘制的几何体范围(增量更新，未变化的部分不会重建)
+     * @return 更新后的 GeoId (可能与传入的不同)
+     */
+    virtual GeoId update(GeoId id, LandAABB const& aabb, DimensionType dimId, mce::Color const& color) = 0;
+
+    /**
+     * @brief 领地范围变化后刷新已绘制的领地，未绘制此领地时不做任何事
+     */
+    virtual void refresh(std::shared_ptr<Land> const& land) = 0;
+
     virtual void remove(GeoId id) = 0;
 
     virtual void remove(LandID landId) = 0;
@@ -42,6 +53,11 @@ class IDrawHandle {
     virtual void clear() = 0;
 
     virtual void clearLand() = 0;
+
+    /**
+     * @brief 估算句柄持有的堆内存(字节)，各句柄共享的几何体不计入
+     */
+    virtual size_t estimateHeapBytes() const { return 0; }
 };
 
 
@@ -0,0 +1,94 @@
+#pragma once
+#include "mc/deps/core/math/Color.h"
+#include "pland/Global.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+
+namespace land {
+
+
+/**
+ * @brief 领地几何体缓存键
+ * 同一领地、同一范围版本、同一样式的几何体在所有玩家的绘制句柄之间共享
+ */
+struct GeometryKey {
+    LandID   landId{0};
+    uint64   rangeVersion{0}; // Land::getRangeVersion()
+    uint32_t style{0};        // 样式(颜色等)，见 PackGeometryStyle
+
+    bool operator==(GeometryKey const&) const = default;
+};
+
+inline uint32_t PackGeometryStyle(mce::Color const& color) {
+    auto channel = [](float v) -> uint32_t {
+        return static_cast<uint32_t>((v < 0.f ? 0.f : v > 1.f ? 1.f : v) * 255.f + 0.5f);
+    };
+    return channel(color.a) << 24 | channel(color.r) << 16 | channel(color.g) << 8 | channel(color.b);
+}
+
+struct GeometryKeyHash {
+    size_t operator()(GeometryKey const& key) const {
+        size_t seed = std::hash<LandID>{}(key.landId);
+        seed ^= std::hash<uint64>{}(key.rangeVersion) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        seed ^= std::hash<uint32_t>{}(key.style) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+/**
+ * @brief 引用计数的几何体缓存
+ * 缓存只持有弱引用，最后一个持有者(绘制句柄)释放后几何体随之销毁，
+ * 内存占用与绘制中的不同领地数量成正比，而非 玩家数 × 领地数
+ * @note 非线程安全，仅在主线程使用
+ */
+template <typename T>
+class SharedGeometryCache final {
+    std::unordered_map<GeometryKey, std::weak_ptr<T>, GeometryKeyHash> mCache;
+    size_t                                                             mPurgeThreshold{64};
+
+public:
+    /**
+     * @brief 获取缓存的几何体，不存在或已过期时调用 factory 构建
+     * @param factory 返回 std::shared_ptr<T>
+     */
+    template <typename Factory>
+    std::shared_ptr<T> getOrCreate(GeometryKey const& key, Factory&& factory) {
+        auto& slot = mCache[key];
+        if (auto ptr = slot.lock()) {
+            return ptr;
+        }
+
+        std::shared_ptr<T> ptr = std::invoke(std::forward<Factory>(factory));
+        slot                   = ptr;
+
+        if (mCache.size() >= mPurgeThreshold) {
+            purgeExpired();
+            mPurgeThreshold = std::max<size_t>(64, mCache.size() * 2);
+        }
+        return ptr;
+    }
+
+    /**
+     * @brief 清理已失效的条目
+     */
+    void purgeExpired() { std::erase_if(mCache, [](auto const& pair) { return pair.second.expired(); }); }
+
+    /**
+     * @brief 存活的几何体数量
+     */
+    size_t size() const {
+        size_t count = 0;
+        for (auto const& [key, weak] : mCache) {
+            count += !weak.expired();
+        }
+        return count;
+    }
+};
+
+
+} // namespace land
@@ -3,6 +3,7 @@
 #include "mc/world/phys/AABB.h"
 #include "pland/aabb/LandAABB.h"
 #include "pland/infra/draw/IDrawHandle.h"
+#include "pland/infra/draw/SharedGeometryCache.h"
 #include "pland/infra/draw/impl/BSCIDrawHandle.h"
 #include "pland/land/Land.h"
 #include <mc/deps/core/utility/AutomaticID.h>
@@ -143,14 +144,60 @@ class BsciDrawHandle::Impl {
     }
 
 
-    std::unique_ptr<bsci::GeometryGroup> mGeometryGroup;
-    std::unordered_map<LandID, GeoId>    mLandGeoMap;
+    // 共享的领地几何体，最后一个持有者释放时从几何组中移除
+    struct SharedBox {
+        std::shared_ptr<bsci::GeometryGroup> group;
+        GeoId                                id;
+        GeometryKey                          key;
+        mce::Color                           color;
+
+        SharedBox(std::shared_ptr<bsci::GeometryGroup> group, GeoId id, GeometryKey key, mce::Color const& color)
+        : group(std::move(group)),
+          id(id),
+          key(key),
+          color(color) {}
+        ~SharedBox() {
+            if (id) {
+                group->remove(id);
+            }
+        }
+    };
+
+    static std::shared_ptr<bsci::GeometryGroup> getSharedGroup() {
+        static std::weak_ptr<bsci::GeometryGroup> shared;
+        auto                                      group = shared.lock();
+        if (!group) {
+            group  = createDefault();
+            shared = group;
+        }
+        return group;
+    }
+
+    static SharedGeometryCache<SharedBox>& getSharedBoxCache() {
+        static SharedGeometryCache<SharedBox> cache;
+        return cache;
+    }
+
 
-    Impl() { mGeometryGroup = createDefault(); }
+    std::unique_ptr<bsci::GeometryGroup>                   mGeometryGroup; // 非领地几何体(选区预览等)
+    std::shared_ptr<bsci::GeometryGroup>                   mSharedGroup;   // 领地几何体(所有句柄共享)
+    std::unordered_map<LandID, std::shared_ptr<SharedBox>> mLandGeoMap;
+    std::unordered_map<GeoId, LandAABB>                    mGeoRanges; // 非领地几何体的范围，用于增量更新
+
+    Impl() : mGeometryGroup(createDefault()), mSharedGroup(getSharedGroup()) {}
     ~Impl() = default;
 
+    std::shared_ptr<SharedBox> acquireLandBox(Land const& land, AABB const& box, mce::Color const& color) {
+        GeometryKey key{land.getId(), land.getRangeVersion(), PackGeometryStyle(color)};
+        return getSharedBoxCache().getOrCreate(key, [&] {
+            auto id = mSharedGroup->box(land.getDimensionId(), box, color);
+            return std::make_shared<SharedBox>(mSharedGroup, id, key, color);
+        });
+    }
+
     void reset() {
         mLandGeoMap.clear();
+        mGeoRanges.clear();
         mGeometryGroup.reset();
         mGeometryGroup = createDefault();
     }
@@ -162,38 +209,70 @@ BsciDrawHandle::BsciDrawHandle() : impl(std::make_unique<Impl>()) {}
 BsciDrawHandle::~BsciDrawHandle() = default;
 
 GeoId BsciDrawHandle::draw(LandAABB const& aabb, DimensionType dimId, mce::Color const& color) {
-    return impl->mGeometryGroup->box(dimId, fixAABB(aabb), color);
+    auto id = impl->mGeometryGroup->box(dimId, fixAABB(aabb), color);
+    if (id) {
+        impl->mGeoRanges.emplace(id, aabb);
+    }
+    return id;
 }
 
 void BsciDrawHandle::draw(std::shared_ptr<Land> const& land, mce::Color const& color) {
-    auto id = draw(land->getAABB(), land->getDimensionId(), color);
-    impl->mLandGeoMap.emplace(land->getId(), id);
+    if (impl->mLandGeoMap.contains(land->getId())) {
+        return;
+    }
+    impl->mLandGeoMap.emplace(land->getId(), impl->acquireLandBox(*land, fixAABB(land->getAABB()), color));
+}
+
+GeoId BsciDrawHandle::update(GeoId id, LandAABB const& aabb, DimensionType dimId, mce::Color const& color) {
+    auto iter = impl->mGeoRanges.find(id);
+    if (iter == impl->mGeoRanges.end()) {
+        return draw(aabb, dimId, color);
+    }
+
+    auto& old = iter->second;
+    if (old == aabb) {
+        return id; // 范围未变化
+    }
+
+    // 尺寸不变时平移已有几何体，避免重建
+    if (old.getDepth() == aabb.getDepth() && old.getWidth() == aabb.getWidth()
+        && old.getHeight() == aabb.getHeight()) {
+        Vec3 offset{aabb.min.x - old.min.x, aabb.min.y - old.min.y, aabb.min.z - old.min.z};
+        if (impl->mGeometryGroup->shift(id, offset)) {
+            old = aabb;
+            return id;
+        }
+    }
+
+    remove(id);
+    return draw(aabb, dimId, color);
+}
+
+void BsciDrawHandle::refresh(std::shared_ptr<Land> const& land) {
+    auto iter = impl->mLandGeoMap.find(land->getId());
+    if (iter == impl->mLandGeoMap.end() || iter->second->key.rangeVersion == land->getRangeVersion()) {
+        return;
+    }
+    // 同一领地的所有持有者都会收到刷新，新几何体只构建一次，旧几何体在最后一个持有者释放后移除
+    iter->second = impl->acquireLandBox(*land, fixAABB(land->getAABB()), iter->second->color);
 }
 
 void BsciDrawHandle::remove(GeoId id) {
     if (id) {
         impl->mGeometryGroup->remove(id);
+        impl->mGeoRanges.erase(id);
     }
 }
 
 void BsciDrawHandle::remove(LandID landId) {
-    auto iter = impl->mLandGeoMap.find(landId);
-    if (iter != impl->mLandGeoMap.end()) {
-        remove(iter->second);
-        impl->mLandGeoMap.erase(iter);
-    }
+    impl->mLandGeoMap.erase(landId); // 共享几何体由引用计数释放
 }
 
 void BsciDrawHandle::remove(std::shared_ptr<Land> land) { remove(land->getId()); }
 
 void BsciDrawHandle::clear() { impl->reset(); }
 
-void BsciDrawHandle::clearLand() {
-    for (auto& [id, geoId] : impl->mLandGeoMap) {
-        impl->mGeometryGroup->remove(geoId);
-    }
-    impl->mLandGeoMap.clear();
-}
+void BsciDrawHandle::clearLand() { impl->mLandGeoMap.clear(); }
 
 bool BsciDrawHandle::isBsciModuleLoaded() { return Impl::isBsciModuleLoadedImpl(); }
 
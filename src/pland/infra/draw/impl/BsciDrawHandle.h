@@ -20,6 +20,10 @@ class BsciDrawHandle final : public IDrawHandle {
 
     LDAPI void draw(std::shared_ptr<Land> const& land, mce::Color const& color) override;
 
+    LDNDAPI GeoId update(GeoId id, LandAABB const& aabb, DimensionType dimId, mce::Color const& color) override;
+
+    LDAPI void refresh(std::shared_ptr<Land> const& land) override;
+
     LDAPI void remove(GeoId id) override;
 
     LDAPI void remove(LandID landId) override;
@@ -1,17 +1,29 @@
 #include "DefaultDrawHandle.h"
 #include "ll/api/coro/CoroTask.h"
 #include "ll/api/coro/InterruptableSleep.h"
+#include "ll/api/service/Bedrock.h"
 #include "ll/api/thread/ServerThreadExecutor.h"
+#include "mc/deps/core/math/Vec3.h"
 #include "mc/network/packet/SpawnParticleEffectPacket.h"
 #include "mc/util/MolangVariable.h"
 #include "mc/util/MolangVariableMap.h"
+#include "mc/world/actor/player/Player.h"
+#include "mc/world/level/Level.h"
 #include "mc/world/level/dimension/VanillaDimensions.h"
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/aabb/LandAABB.h"
+#include "pland/infra/Config.h"
+#include "pland/infra/SpanTracer.h"
 #include "pland/infra/draw/IDrawHandle.h"
+#include "pland/infra/draw/SharedGeometryCache.h"
 #include "pland/land/Land.h"
+#include "pland/utils/MemoryEstimate.h"
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <optional>
+#include <vector>
 
 // Fix LNK2019: "public: __cdecl MolangVariableMap::MolangVariableMap(class MolangVariableMap const &)"
 MolangVariableMap::MolangVariableMap(MolangVariableMap const& rhs) {
@@ -26,94 +38,398 @@ MolangVariableMap::MolangVariableMap(MolangVariableMap const& rhs) {
 namespace land {
 
 
+// 领地边框的一条棱，覆盖 origin + axis * [0, length]
+struct OutlineEdge {
+    Vec3 origin;
+    int  axis;   // 0: x, 1: y, 2: z
+    int  length; // 棱长(格)
+
+    bool operator==(OutlineEdge const&) const = default;
+};
+
 class ParticleSpawner {
-    GeoId                                  mId;
-    std::vector<SpawnParticleEffectPacket> mPackets;
-    int                                    mDimensionId;
+    GeoId                    mId;
+    std::vector<OutlineEdge> mEdges;
+    int                      mDimensionId;
 
     static GeoId getNextGeoId() {
         static uint64 id{1};
         return GeoId{id++};
     }
 
+    void addEdge(Vec3 const& origin, int axis, int length) {
+        if (length < 0) {
+            return;
+        }
+        OutlineEdge edge{origin, axis, length};
+        if (std::find(mEdges.begin(), mEdges.end(), edge) == mEdges.end()) {
+            mEdges.push_back(edge); // 扁平/单格领地的棱会重合
+        }
+    }
+
 public:
     LD_DISALLOW_COPY(ParticleSpawner);
     ParticleSpawner(ParticleSpawner&&) noexcept            = default;
     ParticleSpawner& operator=(ParticleSpawner&&) noexcept = default;
 
-    explicit ParticleSpawner(LandAABB const& aabb, LandDimid dimId) : mId(getNextGeoId()), mDimensionId(dimId) {
-        static std::optional<MolangVariableMap> molang{std::nullopt};
-        if (!molang) {
-            molang = MolangVariableMap{}; // TODO: 验证 Molang 是否真的有效
-            molang->setMolangVariable("variable.particle_lifetime", 25);
-        }
+    explicit ParticleSpawner(LandAABB const& aabb, LandDimid dimId) : ParticleSpawner(getNextGeoId(), aabb, dimId) {}
+
+    explicit ParticleSpawner(GeoId id, LandAABB const& aabb, LandDimid dimId) : mId(id), mDimensionId(dimId) {
+        auto& min = aabb.min;
+        auto& max = aabb.max;
 
-        auto dim    = VanillaDimensions::fromSerializedInt(dimId);
-        auto points = aabb.getBorder();
-        mPackets.reserve(points.size());
-        for (auto& point : points) {
-            mPackets.emplace_back(
-                Vec3{point.x + 0.5, point.y + 0.5, point.z + 0.5},
-                "minecraft:villager_happy",
-                dim,
-                molang
-            );
+        float const xs[2] = {min.x + 0.5f, max.x + 0.5f};
+        float const ys[2] = {min.y + 0.5f, max.y + 0.5f};
+        float const zs[2] = {min.z + 0.5f, max.z + 0.5f};
+
+        mEdges.reserve(12);
+        // 与 LandAABB::getBorder 一致：x 方向的棱包含角点，y/z 方向的棱不包含
+        for (auto y : ys) {
+            for (auto z : zs) {
+                addEdge(Vec3{xs[0], y, z}, 0, max.x - min.x);
+            }
+        }
+        for (auto x : xs) {
+            for (auto z : zs) {
+                addEdge(Vec3{x, ys[0] + 1, z}, 1, max.y - min.y - 2);
+            }
+        }
+        for (auto x : xs) {
+            for (auto y : ys) {
+                addEdge(Vec3{x, y, zs[0] + 1}, 2, max.z - min.z - 2);
+            }
         }
     }
 
     GeoId getId() const { return mId; }
 
-    void tick() {
-        for (auto& packet : mPackets) {
-            packet.sendTo(*packet.mPos, mDimensionId);
-        }
+    int getDimensionId() const { return mDimensionId; }
+
+    std::vector<OutlineEdge> const& getEdges() const { return mEdges; }
+
+    bool isSameOutline(ParticleSpawner const& other) const {
+        return mDimensionId == other.mDimensionId && mEdges == other.mEdges;
     }
 };
 
-class DefaultDrawHandle::Impl {
-    std::unordered_map<GeoId, ParticleSpawner>    mSpawners;
-    std::unordered_map<LandID, GeoId>             mDrawedLands;
+static SharedGeometryCache<ParticleSpawner const> SpawnerCache; // 领地边框共享缓存
+
+
+// 粒子发送源(每个 DefaultDrawHandle 一个)，由 ParticlePump 统一调度
+class ParticleStream {
+public:
+    virtual ~ParticleStream() = default;
+
+    virtual void   prepare()           = 0; // 推进周期，必要时重建发送队列
+    virtual size_t desired() const     = 0; // 本 tick 期望发送的数量(已在周期内均摊)
+    virtual size_t flush(size_t quota) = 0; // 发送至多 quota 个粒子，返回实际发送数量
+};
+
+/**
+ * @brief 所有 DefaultDrawHandle 共享的粒子泵
+ * 每 tick 按全局预算轮询各玩家的发送队列，同一玩家的粒子连续发送；
+ * 超出预算的粒子顺延到后续 tick，周期结束仍未发送的计为丢弃
+ */
+class ParticlePump {
+    struct Stats {
+        uint64 sent{0};
+        uint64 deferred{0};
+        uint64 dropped{0};
+    };
+
+    static constexpr int ReportInterval = 600; // 统计输出间隔(tick)
+
+    std::vector<ParticleStream*>                  mStreams;
+    size_t                                        mRoundRobin{0};
+    Stats                                         mStats;
+    int                                           mReportCounter{0};
     std::shared_ptr<std::atomic<bool>>            mQuit;
     std::shared_ptr<ll::coro::InterruptableSleep> mSleep;
 
+    void tick() {
+        if (mStreams.empty()) {
+            return;
+        }
+        LD_TRACE_SPAN("ParticlePump::tick");
+
+        for (auto stream : mStreams) {
+            stream->prepare();
+        }
+
+        size_t       budget = static_cast<size_t>(std::max(Config::cfg.land.particle.maxPacketsPerTickGlobal, 0));
+        size_t const count  = mStreams.size();
+        size_t const start  = mRoundRobin++ % count; // 轮换起点，避免预算总是被同一玩家占用
+        for (size_t i = 0; i < count; ++i) {
+            auto   stream = mStreams[(start + i) % count];
+            size_t want   = stream->desired();
+            if (want == 0) {
+                continue;
+            }
+            size_t sent      = budget > 0 ? stream->flush(std::min(want, budget)) : 0;
+            budget          -= sent;
+            mStats.sent     += sent;
+            mStats.deferred += want - sent;
+        }
+
+        if (++mReportCounter >= ReportInterval) {
+            mReportCounter = 0;
+            if (mStats.deferred != 0 || mStats.dropped != 0) {
+                PLand::getInstance().getSelf().getLogger().debug(
+                    "[ParticlePump] streams: {}, sent: {}, deferred: {}, dropped: {}",
+                    count,
+                    mStats.sent,
+                    mStats.deferred,
+                    mStats.dropped
+                );
+            }
+            mStats = {};
+        }
+    }
+
 public:
-    explicit Impl() {
+    LD_DISALLOW_COPY_AND_MOVE(ParticlePump);
+
+    explicit ParticlePump() {
         mQuit  = std::make_shared<std::atomic<bool>>(false);
         mSleep = std::make_shared<ll::coro::InterruptableSleep>();
 
         ll::coro::keepThis([quit = mQuit, sleep = mSleep, this]() -> ll::coro::CoroTask<> {
             while (!quit->load()) {
-                co_await sleep->sleepFor(30_tick);
+                co_await sleep->sleepFor(1_tick);
                 if (quit->load()) {
                     break;
                 }
-
-                for (auto& [id, spawner] : mSpawners) {
-                    spawner.tick();
-                }
+                tick();
             }
             co_return;
         }).launch(ll::thread::ServerThreadExecutor::getDefault());
     }
 
-    ~Impl() {
+    ~ParticlePump() {
         mQuit->store(true);
         mSleep->interrupt(true);
     }
 
-    GeoId draw(LandAABB const& aabb, LandDimid dimId) {
-        auto spawner = ParticleSpawner(aabb, dimId);
-        auto id      = spawner.getId();
-        mSpawners.insert({id, std::move(spawner)});
+    // 所有句柄共享一个实例，最后一个句柄销毁时停止
+    static std::shared_ptr<ParticlePump> acquire() {
+        static std::weak_ptr<ParticlePump> instance;
+        auto                               pump = instance.lock();
+        if (!pump) {
+            pump     = std::make_shared<ParticlePump>();
+            instance = pump;
+        }
+        return pump;
+    }
+
+    void add(ParticleStream* stream) { mStreams.push_back(stream); }
+
+    void remove(ParticleStream* stream) { std::erase(mStreams, stream); }
+
+    void addDropped(size_t count) { mStats.dropped += count; }
+};
+
+class DefaultDrawHandle::Impl final : public ParticleStream {
+    struct QueuedPoint {
+        Vec3  pos;
+        float distanceSq;
+    };
+
+    static constexpr int RefreshInterval = 30; // 粒子生命周期(tick)
+
+    UUIDm                                                             mViewer;
+    std::unordered_map<GeoId, std::shared_ptr<ParticleSpawner const>> mSpawners;
+    std::unordered_map<LandID, GeoId>                                 mDrawedLands;
+    std::unordered_map<LandID, uint64>                                mDrawedVersions;         // 已绘制领地的范围版本
+    std::vector<QueuedPoint>                                          mQueue;                  // 当前周期待发送的粒子
+    size_t                                                            mCursor{0};              // mQueue 发送进度
+    int                                                               mTickCounter{RefreshInterval};
+    std::optional<SpawnParticleEffectPacket>                          mPacket;                 // 复用的粒子包
+    int                                                               mPacketDimId{-1};
+    Player*                                                           mCurrentViewer{nullptr}; // 仅在当前 tick 有效
+    std::shared_ptr<ParticlePump>                                     mPump;
+
+    static int getSpacing(float distance) {
+        auto& cfg     = Config::cfg.land.particle;
+        int   spacing = 1 + static_cast<int>(distance) / std::max(cfg.lodStep, 1);
+        return std::clamp(spacing, 1, std::max(cfg.maxSpacing, 1));
+    }
+
+    // 在可视球内按距离自适应间距采样一条棱
+    static void sampleEdge(OutlineEdge const& edge, Vec3 const& eye, float viewDistSq, std::vector<QueuedPoint>& out) {
+        float const origin[3] = {edge.origin.x, edge.origin.y, edge.origin.z};
+        float const viewer[3] = {eye.x, eye.y, eye.z};
+
+        float perpSq = 0;
+        for (int i = 0; i < 3; ++i) {
+            if (i != edge.axis) {
+                float d  = viewer[i] - origin[i];
+                perpSq  += d * d;
+            }
+        }
+        if (perpSq > viewDistSq) {
+            return; // 整条棱都在可视范围外
+        }
+
+        float const half   = std::sqrt(viewDistSq - perpSq);
+        float const center = viewer[edge.axis] - origin[edge.axis];
+        int const   begin  = std::max(0, static_cast<int>(std::ceil(center - half)));
+        int const   end    = std::min(edge.length, static_cast<int>(std::floor(center + half)));
+
+        for (int t = begin; t <= end;) {
+            float along  = static_cast<float>(t) - center;
+            float distSq = perpSq + along * along;
+
+            float point[3]     = {origin[0], origin[1], origin[2]};
+            point[edge.axis]  += static_cast<float>(t);
+            out.push_back({Vec3{point[0], point[1], point[2]}, distSq});
+
+            // 对齐到间距的整数倍，避免玩家移动时粒子位置抖动
+            int spacing = getSpacing(std::sqrt(distSq));
+            t           = (t / spacing + 1) * spacing;
+        }
+    }
+
+    void rebuildQueue(Player& player) {
+        auto& cfg = Config::cfg.land.particle;
+
+        if (mCursor < mQueue.size()) {
+            mPump->addDropped(mQueue.size() - mCursor); // 上一周期未能发出
+        }
+        mQueue.clear();
+        mCursor = 0;
+
+        int const   dimId      = player.getDimensionId().id;
+        auto const& eye        = player.getPosition();
+        float const viewDist   = static_cast<float>(std::max(cfg.viewDistance, 0));
+        float const viewDistSq = viewDist * viewDist;
+
+        for (auto& [id, spawner] : mSpawners) {
+            if (spawner->getDimensionId() != dimId) {
+                continue;
+            }
+            for (auto& edge : spawner->getEdges()) {
+                sampleEdge(edge, eye, viewDistSq, mQueue);
+            }
+        }
+
+        // 一个周期内最多发送 maxPacketsPerTick * RefreshInterval 个粒子，超出时保留最近的
+        size_t const capacity = static_cast<size_t>(std::max(cfg.maxPacketsPerTick, 0)) * RefreshInterval;
+        if (mQueue.size() > capacity) {
+            auto nth = mQueue.begin() + static_cast<std::ptrdiff_t>(capacity);
+            std::nth_element(mQueue.begin(), nth, mQueue.end(), [](QueuedPoint const& a, QueuedPoint const& b) {
+                return a.distanceSq < b.distanceSq;
+            });
+            mPump->addDropped(mQueue.size() - capacity);
+            mQueue.resize(capacity);
+        }
+
+        if (!mPacket || mPacketDimId != dimId) {
+            static std::optional<MolangVariableMap> molang{std::nullopt};
+            if (!molang) {
+                molang = MolangVariableMap{}; // TODO: 验证 Molang 是否真的有效
+                molang->setMolangVariable("variable.particle_lifetime", 25);
+            }
+            mPacket.emplace(Vec3{}, "minecraft:villager_happy", VanillaDimensions::fromSerializedInt(dimId), molang);
+            mPacketDimId = dimId;
+        }
+    }
+
+public:
+    explicit Impl(UUIDm const& viewer) : mViewer(viewer), mPump(ParticlePump::acquire()) { mPump->add(this); }
+
+    ~Impl() override { mPump->remove(this); }
+
+    void prepare() override {
+        mCurrentViewer = nullptr;
+        if (mSpawners.empty()) {
+            mQueue.clear();
+            mCursor      = 0;
+            mTickCounter = RefreshInterval;
+            return;
+        }
+
+        auto player = ll::service::getLevel()->getPlayer(mViewer);
+        if (!player) {
+            return;
+        }
+        mCurrentViewer = player;
+
+        if (++mTickCounter >= RefreshInterval) {
+            mTickCounter = 0;
+            rebuildQueue(*player);
+        }
+    }
+
+    size_t desired() const override {
+        if (!mCurrentViewer || mCursor >= mQueue.size()) {
+            return 0;
+        }
+        // 剩余粒子均摊到本周期剩余的 tick 上，再受单玩家预算限制
+        size_t const remaining = mQueue.size() - mCursor;
+        size_t const ticksLeft = static_cast<size_t>(std::max(RefreshInterval - mTickCounter, 1));
+        size_t const perTick   = (remaining + ticksLeft - 1) / ticksLeft;
+        return std::min(perTick, static_cast<size_t>(std::max(Config::cfg.land.particle.maxPacketsPerTick, 0)));
+    }
+
+    size_t flush(size_t quota) override {
+        size_t const end  = std::min(mQueue.size(), mCursor + quota);
+        size_t const sent = end - mCursor;
+        for (; mCursor < end; ++mCursor) {
+            *mPacket->mPos = mQueue[mCursor].pos;
+            mPacket->sendTo(*mCurrentViewer);
+        }
+        return sent;
+    }
+
+    GeoId draw(std::shared_ptr<ParticleSpawner const> spawner) {
+        auto id = spawner->getId();
+        mSpawners.emplace(id, std::move(spawner));
+        mTickCounter = RefreshInterval; // 下一 tick 立即刷新
         return id;
     }
 
+    GeoId draw(LandAABB const& aabb, LandDimid dimId) {
+        return this->draw(std::make_shared<ParticleSpawner const>(aabb, dimId));
+    }
+
     void draw(SharedLand const& land) {
         if (mDrawedLands.contains(land->getId())) {
             return;
         }
-        auto id                     = this->draw(land->getAABB(), land->getDimensionId());
-        mDrawedLands[land->getId()] = id;
+        // 领地边框在所有玩家之间共享，仅在范围变化(版本递增)后重新构建
+        auto spawner = SpawnerCache.getOrCreate({land->getId(), land->getRangeVersion(), 0}, [&] {
+            return std::make_shared<ParticleSpawner const>(land->getAABB(), land->getDimensionId());
+        });
+        mDrawedLands[land->getId()]    = this->draw(std::move(spawner));
+        mDrawedVersions[land->getId()] = land->getRangeVersion();
+    }
+
+    GeoId update(GeoId id, LandAABB const& aabb, LandDimid dimId) {
+        auto iter = mSpawners.find(id);
+        if (iter == mSpawners.end()) {
+            return this->draw(aabb, dimId);
+        }
+
+        // 沿用原 GeoId，边框未变化时不做任何事
+        auto next = std::make_shared<ParticleSpawner const>(id, aabb, dimId);
+        if (!iter->second->isSameOutline(*next)) {
+            iter->second = std::move(next);
+            mTickCounter = RefreshInterval;
+        }
+        return id;
+    }
+
+    void refresh(SharedLand const& land) {
+        auto iter = mDrawedLands.find(land->getId());
+        if (iter == mDrawedLands.end() || mDrawedVersions[land->getId()] == land->getRangeVersion()) {
+            return;
+        }
+        auto spawner = SpawnerCache.getOrCreate({land->getId(), land->getRangeVersion(), 0}, [&] {
+            return std::make_shared<ParticleSpawner const>(land->getAABB(), land->getDimensionId());
+        });
+        mSpawners.erase(iter->second);
+        iter->second                   = this->draw(std::move(spawner));
+        mDrawedVersions[land->getId()] = land->getRangeVersion();
     }
 
     void remove(GeoId id) {
@@ -122,7 +438,9 @@ class DefaultDrawHandle::Impl {
             id.value,
             mSpawners.contains(id)
         );
-        mSpawners.erase(id);
+        if (mSpawners.erase(id)) {
+            mTickCounter = RefreshInterval;
+        }
     }
 
     void remove(LandID landId) {
@@ -130,12 +448,15 @@ class DefaultDrawHandle::Impl {
         if (iter != mDrawedLands.end()) {
             this->remove(iter->second);
             mDrawedLands.erase(iter);
+            mDrawedVersions.erase(landId);
         }
     }
 
     void clear() {
         mSpawners.clear();
+        mQueue.clear();
         mDrawedLands.clear();
+        mDrawedVersions.clear();
     }
 
     void clearLand() {
@@ -146,10 +467,17 @@ class DefaultDrawHandle::Impl {
             iter = mDrawedLands.erase(iter);
         }
         mDrawedLands.clear();
+        mDrawedVersions.clear();
+    }
+
+    size_t estimateHeapBytes() const {
+        using mem_utils::heapBytes;
+        return sizeof(Impl) + heapBytes(mSpawners) + heapBytes(mDrawedLands) + heapBytes(mDrawedVersions)
+             + heapBytes(mQueue);
     }
 };
 
-DefaultDrawHandle::DefaultDrawHandle() : impl(std::make_unique<Impl>()) {}
+DefaultDrawHandle::DefaultDrawHandle(UUIDm const& viewer) : impl(std::make_unique<Impl>(viewer)) {}
 
 DefaultDrawHandle::~DefaultDrawHandle() = default;
 
@@ -159,6 +487,12 @@ GeoId DefaultDrawHandle::draw(LandAABB const& aabb, DimensionType dimId, mce::Co
 
 void DefaultDrawHandle::draw(std::shared_ptr<Land> const& land, mce::Color const&) { impl->draw(land); }
 
+GeoId DefaultDrawHandle::update(GeoId id, LandAABB const& aabb, DimensionType dimId, mce::Color const&) {
+    return impl->update(id, aabb, dimId);
+}
+
+void DefaultDrawHandle::refresh(std::shared_ptr<Land> const& land) { impl->refresh(land); }
+
 void DefaultDrawHandle::remove(GeoId id) { impl->remove(id); }
 
 void DefaultDrawHandle::remove(LandID landId) { impl->remove(landId); }
@@ -169,5 +503,7 @@ void DefaultDrawHandle::clear() { impl->clear(); }
 
 void DefaultDrawHandle::clearLand() { impl->clearLand(); }
 
+size_t DefaultDrawHandle::estimateHeapBytes() const { return impl->estimateHeapBytes(); }
+
 
 } // namespace land
\ No newline at end of file
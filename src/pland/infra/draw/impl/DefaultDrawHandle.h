@@ -5,18 +5,26 @@
 namespace land {
 
 
+/**
+ * @brief 内置粒子绘制
+ * 粒子只发送给持有此句柄的玩家，按距离做 LOD 与剔除，并限制每 tick 的发包数量
+ */
 class DefaultDrawHandle final : public IDrawHandle {
     class Impl;
     std::unique_ptr<Impl> impl;
 
 public:
-    LDAPI explicit DefaultDrawHandle();
+    LDAPI explicit DefaultDrawHandle(UUIDm const& viewer);
     LDAPI ~DefaultDrawHandle() override;
 
     LDNDAPI GeoId draw(LandAABB const& aabb, DimensionType dimId, mce::Color const& color) override;
 
     LDAPI void draw(std::shared_ptr<Land> const& land, mce::Color const& color) override;
 
+    LDNDAPI GeoId update(GeoId id, LandAABB const& aabb, DimensionType dimId, mce::Color const& color) override;
+
+    LDAPI void refresh(std::shared_ptr<Land> const& land) override;
+
     LDAPI void remove(GeoId id) override;
 
     LDAPI void remove(LandID landId) override;
@@ -26,6 +34,8 @@ class DefaultDrawHandle final : public IDrawHandle {
     LDAPI void clear() override;
 
     LDAPI void clearLand() override;
+
+    LDNDAPI size_t estimateHeapBytes() const override;
 };
 
 
@@ -4,8 +4,15 @@
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/infra/Config.h"
+#include "pland/land/LandJournal.h"
 #include "pland/land/LandRegistry.h"
+#include "pland/land/LandSnapshot.h"
 #include "pland/utils/JSON.h"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <stack>
 #include <vector>
 
@@ -13,22 +20,153 @@
 namespace land {
 
 
-Land::Land() = default;
-Land::Land(LandContext ctx) : mContext(std::move(ctx)) {}
+Land::Land() { internTextFields(); }
+Land::Land(LandContext ctx) : mContext(std::move(ctx)) { internTextFields(); }
 Land::Land(LandAABB const& pos, LandDimid dimid, bool is3D, UUIDs const& owner) {
     mContext.mPos           = pos;
     mContext.mLandDimid     = dimid;
     mContext.mIs3DLand      = is3D;
     mContext.mLandOwner     = owner;
     mContext.mLandPermTable = PLand::getInstance().getLandRegistry()->getLandTemplatePermTable().get();
+    internTextFields();
+}
+
+void Land::internTextFields() {
+    mOwner    = InternedString{mContext.mLandOwner};
+    mName     = InternedString{mContext.mLandName};
+    mDescribe = InternedString{mContext.mLandDescribe};
+    // 文本字段只保存在句柄中，成员仍保存在 mContext 中(getMembers 返回其引用)
+    std::string{}.swap(mContext.mLandOwner);
+    std::string{}.swap(mContext.mLandName);
+    std::string{}.swap(mContext.mLandDescribe);
+}
+
+LandContext Land::makeContext() const {
+    ensureResident();
+    LandContext ctx   = mContext;
+    ctx.mLandOwner    = mOwner.str();
+    ctx.mLandName     = mName.str();
+    ctx.mLandDescribe = mDescribe.str();
+    return ctx;
+}
+
+namespace {
+
+// 解析启动快照的锁(按领地地址分片)，与后台解析线程互斥
+std::mutex& snapshotParseMutex(Land const* land) {
+    static std::array<std::mutex, 64> mutexes;
+    return mutexes[std::hash<Land const*>{}(land) % mutexes.size()];
+}
+
+} // namespace
+
+SharedLand Land::makeFromSnapshot(std::shared_ptr<LandSnapshot const> snapshot, std::string_view json) {
+    auto land              = make();
+    land->mSnapshotPayload = std::make_unique<SnapshotPayload>(std::move(snapshot), json);
+    land->mParsed.store(false, std::memory_order_release);
+    return land;
+}
+
+void Land::parseSnapshotPayload() const {
+    std::lock_guard lock(snapshotParseMutex(this));
+    if (mParsed.load(std::memory_order_acquire)) {
+        return; // 已被其他线程解析
+    }
+    auto& self = const_cast<Land&>(*this); // 领地总是由 make 创建，解析只发生一次
+    try {
+        auto json = JSON::parse(mSnapshotPayload->json);
+        LandRegistry::_checkVersionAndTryAdaptBreakingChanges(json);
+        JSON::jsonToStruct(json, self.mContext);
+        self.internTextFields();
+    } catch (std::exception const& e) {
+        PLand::getInstance().getSelf().getLogger().error("解析启动快照中的领地失败: {}", e.what());
+    }
+    self.mSnapshotPayload.reset();
+    mParsed.store(true, std::memory_order_release);
+}
+
+bool Land::ensureResident() const {
+    ensureParsed();
+    touch();
+    if (mResident) [[likely]] {
+        return true;
+    }
+    auto registry = PLand::getInstance().getLandRegistry();
+    auto detail   = registry ? registry->_readLandContext(mContext.mLandID) : std::nullopt;
+    if (!detail) {
+        PLand::getInstance().getSelf().getLogger().error("重新加载领地数据失败, ID: {}", mContext.mLandID);
+        return false;
+    }
+    return const_cast<Land&>(*this).installDetail(mResidentGeneration, std::move(*detail));
+}
+
+void Land::requestResident() const {
+    if (mResident || mLoadRequested) {
+        return;
+    }
+    if (auto registry = PLand::getInstance().getLandRegistry()) {
+        mLoadRequested = true;
+        registry->_requestLandDetail(mContext.mLandID, mResidentGeneration);
+    }
+}
+
+bool Land::mayBeMember(UUIDs const& uuid) const {
+    return std::ranges::find(mEvictedMemberHashes, std::hash<UUIDs>{}(uuid)) != mEvictedMemberHashes.end();
+}
+
+bool Land::evict() {
+    if (!mParsed.load(std::memory_order_acquire) || !mResident || isDirty()) {
+        return false; // 修改过的领地在保存前不能换出，数据库中的数据不是最新的
+    }
+    for (auto const& member : mContext.mLandMembers) {
+        mEvictedMemberHashes.push_back(std::hash<UUIDs>{}(member));
+    }
+    std::vector<UUIDs>{}.swap(mContext.mLandMembers);
+    mName     = InternedString{};
+    mDescribe = InternedString{};
+
+    mResident      = false;
+    mLoadRequested = false;
+    ++mResidentGeneration;
+    return true;
+}
+
+bool Land::installDetail(uint32_t generation, LandContext&& detail) {
+    if (mResident || generation != mResidentGeneration) {
+        return false; // 已同步加载，或加载期间又被换出
+    }
+    // 换出期间这些字段不会被修改(修改前都会先同步加载)，数据库中的即为最新数据
+    mContext.mLandMembers = std::move(detail.mLandMembers);
+    mName                 = InternedString{detail.mLandName};
+    mDescribe             = InternedString{detail.mLandDescribe};
+    std::vector<size_t>{}.swap(mEvictedMemberHashes);
+
+    mResident      = true;
+    mLoadRequested = false;
+    return true;
 }
 
 SharedLand Land::getSelfFromRegistry() const {
+    ensureParsed();
     return PLand::getInstance().getLandRegistry()->getLand(mContext.mLandID);
 }
 
-LandAABB const& Land::getAABB() const { return mContext.mPos; }
-bool            Land::setAABB(LandAABB const& newRange) {
+void Land::markDirty() { markDirty(LandJournalRecord::Upsert, {}); }
+void Land::markDirty(LandJournalRecord record, std::string payload) {
+    mDirtyCounter.increment();
+    if (getId() == LandID(-1)) {
+        return; // 尚未加入注册表，由 LandRegistry 添加时记录
+    }
+    if (auto registry = PLand::getInstance().getLandRegistry()) {
+        registry->_onLandModified(*this, record, std::move(payload));
+    }
+}
+
+LandAABB const& Land::getAABB() const {
+    ensureParsed();
+    return mContext.mPos;
+}
+bool Land::setAABB(LandAABB const& newRange) {
     if (!isOrdinaryLand()) {
         return false;
     }
@@ -42,66 +180,135 @@ bool            Land::setAABB(LandAABB const& newRange) {
         return false; // 领地范围与其他领地重叠
     }
     mContext.mPos = newRange;
-    mDirtyCounter.increment();
+    markDirty(
+        LandJournalRecord::SetRange,
+        LandJournal::encodeInts(
+            {newRange.min.x, newRange.min.y, newRange.min.z, newRange.max.x, newRange.max.y, newRange.max.z}
+        )
+    );
     return true;
 }
 
-LandPos const& Land::getTeleportPos() const { return mContext.mTeleportPos; }
-void           Land::setTeleportPos(LandPos const& pos) {
+uint64 Land::getRangeVersion() const { return mRangeVersion; }
+
+LandPos const& Land::getTeleportPos() const {
+    ensureParsed();
+    return mContext.mTeleportPos;
+}
+void Land::setTeleportPos(LandPos const& pos) {
+    ensureParsed();
     mContext.mTeleportPos = pos;
-    mDirtyCounter.increment();
+    markDirty(LandJournalRecord::SetTeleportPos, LandJournal::encodeInts({pos.x, pos.y, pos.z}));
 }
 
-LandID    Land::getId() const { return mContext.mLandID; }
-LandDimid Land::getDimensionId() const { return mContext.mLandDimid; }
+LandID Land::getId() const {
+    ensureParsed();
+    return mContext.mLandID;
+}
+LandDimid Land::getDimensionId() const {
+    ensureParsed();
+    return mContext.mLandDimid;
+}
 
-LandPermTable const& Land::getPermTable() const { return mContext.mLandPermTable; }
-void                 Land::setPermTable(LandPermTable permTable) {
+LandPermTable const& Land::getPermTable() const {
+    ensureParsed();
+    return mContext.mLandPermTable;
+}
+void Land::setPermTable(LandPermTable permTable) {
+    ensureParsed();
     mContext.mLandPermTable = std::move(permTable);
-    mDirtyCounter.increment();
+    // 权限表是唯一需要序列化的字段，未启用预写日志时跳过
+    auto payload = Config::cfg.land.journal.enabled ? JSON::structTojson(mContext.mLandPermTable).dump() : "";
+    markDirty(LandJournalRecord::SetPermTable, std::move(payload));
 }
 
-UUIDs const& Land::getOwner() const { return mContext.mLandOwner; }
-void         Land::setOwner(UUIDs const& uuid) {
-    mContext.mLandOwner = uuid;
-    mDirtyCounter.increment();
+UUIDs const& Land::getOwner() const {
+    ensureParsed();
+    return mOwner.str();
+}
+void Land::setOwner(UUIDs const& uuid) {
+    ensureParsed();
+    mOwner = InternedString{uuid};
+    markDirty(LandJournalRecord::SetOwner, uuid);
 }
 
-std::vector<UUIDs> const& Land::getMembers() const { return mContext.mLandMembers; }
-void                      Land::addLandMember(UUIDs const& uuid) {
+std::vector<UUIDs> const& Land::getMembers() const {
+    ensureResident();
+    return mContext.mLandMembers;
+}
+void Land::addLandMember(UUIDs const& uuid) {
+    if (!ensureResident()) {
+        return; // 无法加载现有成员，写入会覆盖数据库中的数据
+    }
     mContext.mLandMembers.push_back(uuid);
-    mDirtyCounter.increment();
+    markDirty(LandJournalRecord::AddMember, uuid);
 }
 void Land::removeLandMember(UUIDs const& uuid) {
-    std::erase_if(mContext.mLandMembers, [uuid](UUIDs const& u) { return u == uuid; });
-    mDirtyCounter.increment();
+    if (!ensureResident()) {
+        return;
+    }
+    std::erase_if(mContext.mLandMembers, [&uuid](UUIDs const& u) { return u == uuid; });
+    markDirty(LandJournalRecord::RemoveMember, uuid);
 }
 
-std::string const& Land::getName() const { return mContext.mLandName; }
-void               Land::setName(std::string const& name) {
-    mContext.mLandName = name;
-    mDirtyCounter.increment();
+std::string const& Land::getName() const {
+    ensureResident();
+    return mName.str();
+}
+void Land::setName(std::string const& name) {
+    if (!ensureResident()) {
+        return;
+    }
+    mName = InternedString{name};
+    markDirty(LandJournalRecord::SetName, name);
 }
 
-std::string const& Land::getDescribe() const { return mContext.mLandDescribe; }
-void               Land::setDescribe(std::string const& describe) {
-    mContext.mLandDescribe = std::string(describe);
-    mDirtyCounter.increment();
+std::string const& Land::getDescribe() const {
+    ensureResident();
+    return mDescribe.str();
+}
+void Land::setDescribe(std::string const& describe) {
+    if (!ensureResident()) {
+        return;
+    }
+    mDescribe = InternedString{describe};
+    markDirty(LandJournalRecord::SetDescribe, describe);
 }
 
-int  Land::getOriginalBuyPrice() const { return mContext.mOriginalBuyPrice; }
+int Land::getOriginalBuyPrice() const {
+    ensureParsed();
+    return mContext.mOriginalBuyPrice;
+}
 void Land::setOriginalBuyPrice(int price) {
+    ensureParsed();
     mContext.mOriginalBuyPrice = price;
-    mDirtyCounter.increment();
+    markDirty(LandJournalRecord::SetOriginalBuyPrice, LandJournal::encodeInts({price}));
 }
 
-bool Land::is3D() const { return mContext.mIs3DLand; }
-bool Land::isOwner(UUIDs const& uuid) const { return mContext.mLandOwner == uuid; }
+bool Land::is3D() const {
+    ensureParsed();
+    return mContext.mIs3DLand;
+}
+bool Land::isOwner(UUIDs const& uuid) const {
+    ensureParsed();
+    return mOwner == uuid;
+}
 bool Land::isMember(UUIDs const& uuid) const {
+    ensureParsed();
+    if (!mResident && !mayBeMember(uuid)) {
+        return false; // 换出期间成员哈希未命中，无需加载
+    }
+    ensureResident();
     return std::ranges::find(mContext.mLandMembers, uuid) != mContext.mLandMembers.end();
 }
-bool Land::isConvertedLand() const { return mContext.mIsConvertedLand; }
-bool Land::isOwnerDataIsXUID() const { return mContext.mOwnerDataIsXUID; }
+bool Land::isConvertedLand() const {
+    ensureParsed();
+    return mContext.mIsConvertedLand;
+}
+bool Land::isOwnerDataIsXUID() const {
+    ensureParsed();
+    return mContext.mOwnerDataIsXUID;
+}
 bool Land::isDirty() const { return mDirtyCounter.isDirty(); }
 
 Land::Type Land::getType() const {
@@ -117,18 +324,28 @@ Land::Type Land::getType() const {
     throw std::runtime_error("Unknown land type");
     [[unlikely]];
 }
-bool Land::hasParentLand() const { return this->mContext.mParentLandID != static_cast<LandID>(-1); }
-bool Land::hasSubLand() const { return !this->mContext.mSubLandIDs.empty(); }
+bool Land::hasParentLand() const {
+    ensureParsed();
+    return this->mContext.mParentLandID != static_cast<LandID>(-1);
+}
+bool Land::hasSubLand() const {
+    ensureParsed();
+    return !this->mContext.mSubLandIDs.empty();
+}
 bool Land::isSubLand() const {
+    ensureParsed();
     return this->mContext.mParentLandID != static_cast<LandID>(-1) && this->mContext.mSubLandIDs.empty();
 }
 bool Land::isParentLand() const {
+    ensureParsed();
     return this->mContext.mParentLandID == static_cast<LandID>(-1) && !this->mContext.mSubLandIDs.empty();
 }
 bool Land::isMixLand() const {
+    ensureParsed();
     return this->mContext.mParentLandID != static_cast<LandID>(-1) && !this->mContext.mSubLandIDs.empty();
 }
 bool Land::isOrdinaryLand() const {
+    ensureParsed();
     return this->mContext.mParentLandID == static_cast<LandID>(-1) && this->mContext.mSubLandIDs.empty();
 }
 bool Land::canCreateSubLand() const {
@@ -247,12 +464,14 @@ std::unordered_set<SharedLand> Land::getSelfAndDescendants() const {
 
 
 bool Land::isCollision(BlockPos const& pos, int radius) const {
+    ensureParsed();
     BlockPos minPos(pos.x - radius, mContext.mIs3DLand ? pos.y - radius : mContext.mPos.min.y, pos.z - radius);
     BlockPos maxPos(pos.x + radius, mContext.mIs3DLand ? pos.y + radius : mContext.mPos.max.y, pos.z + radius);
     return isCollision(minPos, maxPos);
 }
 
 bool Land::isCollision(BlockPos const& pos1, BlockPos const& pos2) const {
+    ensureParsed();
     return LandAABB::isCollision(
         mContext.mPos,
         LandAABB{
@@ -266,20 +485,34 @@ bool Land::isCollision(BlockPos const& pos1, BlockPos const& pos2) const {
 LandPermType Land::getPermType(UUIDs const& uuid) const {
     if (uuid.empty()) return LandPermType::Guest; // empty uuid is guest
     if (isOwner(uuid)) return LandPermType::Owner;
+    if (!mResident) [[unlikely]] {
+        // 权限判断不读取数据库: 成员哈希命中时异步加载，加载完成前按访客处理
+        if (mayBeMember(uuid)) requestResident();
+        return LandPermType::Guest;
+    }
     if (isMember(uuid)) return LandPermType::Member;
     return LandPermType::Guest;
 }
 
 void Land::updateXUIDToUUID(UUIDs const& ownerUUID) {
     if (isConvertedLand() && isOwnerDataIsXUID()) {
-        mContext.mLandOwner       = ownerUUID;
+        mOwner                    = InternedString{ownerUUID};
         mContext.mOwnerDataIsXUID = false;
-        mDirtyCounter.increment();
+        markDirty();
     }
 }
 
-void           Land::load(nlohmann::json& json) { JSON::jsonToStruct(json, mContext); }
-nlohmann::json Land::dump() const { return JSON::structTojson(mContext); }
+void Land::load(nlohmann::json& json) {
+    ensureParsed(); // 丢弃尚未解析的快照数据
+    JSON::jsonToStruct(json, mContext);
+    internTextFields();
+    std::vector<size_t>{}.swap(mEvictedMemberHashes);
+    mResident = true;
+}
+nlohmann::json Land::dump() const {
+    auto ctx = makeContext();
+    return JSON::structTojson(ctx);
+}
 void           Land::save(bool force) {
     if (isDirty() || force) {
         if (PLand::getInstance().getLandRegistry()->save(*this)) {
@@ -289,7 +522,7 @@ void           Land::save(bool force) {
 }
 
 
-bool Land::operator==(SharedLand const& other) const { return mContext.mLandID == other->mContext.mLandID; }
+bool Land::operator==(SharedLand const& other) const { return getId() == other->getId(); }
 
 
 // static
@@ -306,7 +539,7 @@ llong Land::calculatePriceRecursively(SharedLand const& land, RecursionCalculati
         if (handle) {
             if (!handle(current, price)) break; // if handle return false, break
         } else {
-            price += current->mContext.mOriginalBuyPrice;
+            price += current->getOriginalBuyPrice();
         }
 
         if (current->hasSubLand()) {
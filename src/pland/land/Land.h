@@ -5,7 +5,11 @@
 #include "pland/Global.h"
 #include "pland/aabb/LandAABB.h"
 #include "pland/infra/DirtyCounter.h"
+#include "pland/infra/StringPool.h"
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -14,6 +18,8 @@ namespace land {
 
 class Land;
 class LandRegistry;
+class LandSnapshot;
+enum class LandJournalRecord : uint8_t;
 
 using SharedLand = std::shared_ptr<Land>; // 共享指针
 using WeakLand   = std::weak_ptr<Land>;   // 弱指针
@@ -28,13 +34,61 @@ class Land final {
     };
 
 private:
-    LandContext  mContext;
-    DirtyCounter mDirtyCounter;
+    // 启动快照中尚未解析的领地 JSON
+    struct SnapshotPayload {
+        std::shared_ptr<LandSnapshot const> snapshot; // 保持映射存活，全部领地解析后随之释放
+        std::string_view                    json;
+    };
+
+    LandContext                      mContext; // 文本字段(主人、名称、描述)为空，实际数据保存在下方的句柄中
+    InternedString                   mOwner;
+    InternedString                   mName;
+    InternedString                   mDescribe;
+    DirtyCounter                     mDirtyCounter;
+    uint64                           mRangeVersion{0}; // 范围版本(不持久化)，每次 LandRegistry::refreshLandRange 时递增
+    std::unique_ptr<SnapshotPayload> mSnapshotPayload; // 仅从启动快照加载且尚未解析时非空
+    mutable std::atomic<bool>        mParsed{true};    // 为 false 时 mContext 等字段尚未从 mSnapshotPayload 解析
+
+    // 懒加载(land.lazyLoad): 名称、描述与成员可被换出，以下字段只在服务器线程访问
+    bool                mResident{true};        // 名称、描述与成员是否在内存中
+    uint32_t            mResidentGeneration{0}; // 每次换出时递增，用于丢弃过期的异步加载结果
+    mutable uint32_t    mLastAccessEpoch{0};    // 最后访问时的换出轮次
+    mutable bool        mLoadRequested{false};  // 是否已请求异步加载
+    std::vector<size_t> mEvictedMemberHashes;   // 换出期间成员 UUID 的哈希，权限判断据此排除非成员
+
+    static inline uint32_t sAccessEpoch{0}; // 当前换出轮次，由 LandRegistry 每分钟递增
 
     friend LandRegistry;
 
+    // 从启动快照创建领地，首次访问(或后台线程)时才解析
+    static SharedLand makeFromSnapshot(std::shared_ptr<LandSnapshot const> snapshot, std::string_view json);
+
+    // 所有读写 mContext 与文本句柄的方法都先调用此函数
+    void ensureParsed() const {
+        if (!mParsed.load(std::memory_order_acquire)) [[unlikely]] {
+            parseSnapshotPayload();
+        }
+    }
+    void parseSnapshotPayload() const;
+
     SharedLand getSelfFromRegistry() const;
 
+    void markDirty();                                              // 标记为已修改，并将整个领地写入领地预写日志
+    void markDirty(LandJournalRecord record, std::string payload); // 标记为已修改，并只记录被修改的字段
+
+    void internTextFields(); // 将 mContext 中的文本字段移入驻留字符串句柄
+
+    void touch() const { mLastAccessEpoch = sAccessEpoch; }
+
+    bool ensureResident() const;               // 被换出时同步从数据库重新加载(不用于权限判断)，失败时返回 false
+    void requestResident() const;              // 被换出时请求异步加载，不等待结果
+    bool mayBeMember(UUIDs const& uuid) const; // 换出期间按成员哈希判断，false 时一定不是成员
+
+    bool evict();                                                  // 换出名称、描述与成员(仅限未修改的领地)
+    bool installDetail(uint32_t generation, LandContext&& detail); // 装入异步加载的数据，换出轮次不符时丢弃
+
+    LandContext makeContext() const; // 生成完整的 LandContext(用于序列化)
+
 public:
     LD_DISALLOW_COPY(Land);
 
@@ -58,6 +112,12 @@ class Land final {
      */
     LDNDAPI bool setAABB(LandAABB const& newRange);
 
+    /**
+     * @brief 获取领地范围版本
+     * @note 用于缓存失效判断(如绘制几何体缓存)，不持久化
+     */
+    LDNDAPI uint64 getRangeVersion() const;
+
     LDNDAPI LandPos const& getTeleportPos() const;
 
     LDAPI void setTeleportPos(LandPos const& pos);
@@ -70,6 +130,11 @@ class Land final {
 
     LDAPI void setPermTable(LandPermTable permTable);
 
+    /**
+     * @brief 获取领地主人
+     * @note 主人、名称、描述保存在驻留字符串池中，返回的引用指向池中的条目，
+     *       调用对应的 set 方法(或懒加载换出名称、描述)后原条目可能被释放，需要跨越修改持有时请复制一份
+     */
     LDNDAPI UUIDs const& getOwner() const;
 
     LDAPI void setOwner(UUIDs const& uuid);
@@ -78,11 +143,11 @@ class Land final {
     LDAPI void                        addLandMember(UUIDs const& uuid);
     LDAPI void                        removeLandMember(UUIDs const& uuid);
 
-    LDNDAPI std::string const& getName() const;
+    LDNDAPI std::string const& getName() const; // 引用有效期同 getOwner
 
     LDAPI void setName(std::string const& name);
 
-    LDNDAPI std::string const& getDescribe() const;
+    LDNDAPI std::string const& getDescribe() const; // 引用有效期同 getOwner
 
     LDAPI void setDescribe(std::string const& describe);
 
@@ -5,13 +5,45 @@
 #include "mc/world/level/dimension/DimensionHeightRange.h"
 #include "pland/PLand.h"
 #include "pland/aabb/LandAABB.h"
+#include "pland/aabb/LandAABBTree.h"
 #include "pland/infra/Config.h"
 #include "pland/land/LandRegistry.h"
 #include "pland/utils/McUtils.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 
 namespace land {
 
+namespace {
+
+// 禁止区域索引(按维度)，条目值为 forbiddenRanges 中的下标
+struct ForbiddenRangeIndex {
+    std::unordered_map<LandDimid, LandAABBTree<size_t>> trees;
+    size_t                                              sourceSize{0}; // 构建时的禁止区域数量
+};
+ForbiddenRangeIndex ForbiddenIndex;
+
+} // namespace
+
+void LandCreateValidator::rebuildForbiddenRangeIndex() {
+    auto const& ranges = Config::cfg.land.bought.forbiddenRanges;
+
+    std::unordered_map<LandDimid, std::vector<LandAABBTree<size_t>::Item>> items;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        auto aabb = ranges[i].aabb;
+        aabb.fix();
+        items[ranges[i].dimensionId].emplace_back(aabb, i);
+    }
+
+    ForbiddenIndex.trees.clear();
+    for (auto& [dimid, list] : items) {
+        ForbiddenIndex.trees[dimid].build(std::move(list));
+    }
+    ForbiddenIndex.sourceSize = ranges.size();
+}
+
 
 LandCreateValidator::ValidateResult LandCreateValidator::validateCreateOrdinaryLand(Player& player, SharedLand land) {
     if (auto res = isPlayerLandCountLimitExceeded(player.getUuid().asString()); !res) {
@@ -72,10 +104,24 @@ LandCreateValidator::ValidateResult LandCreateValidator::isPlayerLandCountLimitE
 
 LandCreateValidator::ValidateResult
 LandCreateValidator::isLandInForbiddenRange(LandAABB const& range, LandDimid dimid) {
-    for (auto const& forbiddenRange : Config::cfg.land.bought.forbiddenRanges) {
-        if (forbiddenRange.dimensionId == dimid && LandAABB::isCollision(forbiddenRange.aabb, range)) {
-            return std::unexpected(ErrorContext::landInForbiddenRange(range, forbiddenRange.aabb));
-        }
+    auto const& ranges = Config::cfg.land.bought.forbiddenRanges;
+    if (ForbiddenIndex.sourceSize != ranges.size()) {
+        rebuildForbiddenRangeIndex(); // 禁止区域被外部修改
+    }
+
+    auto tree = ForbiddenIndex.trees.find(dimid);
+    if (tree == ForbiddenIndex.trees.end()) {
+        return {};
+    }
+
+    // 多个禁止区域相交时，与线性查找保持一致，报告配置中靠前的一个
+    size_t hit = ranges.size();
+    tree->second.query(range, [&](LandAABB const&, size_t index) {
+        hit = std::min(hit, index);
+        return true;
+    });
+    if (hit < ranges.size()) {
+        return std::unexpected(ErrorContext::landInForbiddenRange(range, ranges[hit].aabb));
     }
     return {};
 }
@@ -165,35 +211,43 @@ LandCreateValidator::isSubLandPositionLegal(SharedLand const& land, LandAABB con
     auto const& minSpacing = Config::cfg.land.subLand.minSpacing;
     auto        expanded   = subRange.expanded(minSpacing, !Config::cfg.land.subLand.minSpacingIncludeY);
 
-    auto family  = land->getFamilyTree();       // 整个领地家族
-    auto parents = land->getSelfAndAncestors(); // 相对于 land 的所有父领地
-
-    // 子领地不能与家族内其他领地冲突
-    for (auto& member : family) {
-        if (member == land) {
-            continue; // 排除自身(因为 sub 是 land 的子领地，所以 land 必然与 sub 冲突)
-        }
-        if (parents.contains(member)) {
-            continue; // 排除父领地(因为 sub 是 land 的子领地，那么必然与整个家族内的父领地冲突)
-        }
+    // 相对于 land 的所有父领地(含自身)，sub 必然位于其中，不参与冲突检查
+    std::vector<LandID> parents;
+    SharedLand          root = land;
+    for (auto current = land; current; current = current->getParentLand()) {
+        parents.push_back(current->getId());
+        root = current;
+    }
 
-        auto& memberAABB = member->getAABB();
+    auto index = PLand::getInstance().getLandRegistry()->getFamilyIndex(root);
+    if (!index) {
+        return {};
+    }
 
+    // 只有与扩展范围相交的家族成员才可能冲突或间距不足
+    ValidateResult result{};
+    index->query(expanded, [&](LandAABB const& memberAABB, WeakLand const& weak) {
+        auto member = weak.lock();
+        if (!member || std::ranges::find(parents, member->getId()) != parents.end()) {
+            return true;
+        }
         if (LandAABB::isCollision(memberAABB, subRange)) {
             // 子领地与家族内其他领地冲突
-            return std::unexpected(ErrorContext::landRangeWithOtherCollision(member));
+            result = std::unexpected(ErrorContext::landRangeWithOtherCollision(member));
+            return false;
         }
         if (!LandAABB::isComplisWithMinSpacing(memberAABB, expanded, minSpacing)) {
             // 子领地与家族内其他领地间距过小
-            return std::unexpected(
+            result = std::unexpected(
                 ErrorContext::landSpacingTooSmall(member, LandAABB::getMinSpacing(memberAABB, expanded), minSpacing)
             );
+            return false;
         }
-    }
-    return {};
+        return true;
+    });
+    return result;
 }
 
-
 // ErrorContext
 LandCreateValidator::ErrorContext LandCreateValidator::ErrorContext::undefined() { return {ErrorCode::Undefined}; }
 
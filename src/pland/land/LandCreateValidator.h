@@ -80,9 +80,15 @@ class LandCreateValidator {
 
     /**
      * @brief 领地是否在禁止范围内
+     * @note 通过按维度构建的禁止区域索引查询
      */
     LDNDAPI static ValidateResult isLandInForbiddenRange(LandAABB const& range, LandDimid dimid);
 
+    /**
+     * @brief 重建禁止区域索引(加载/重载配置时调用)
+     */
+    LDAPI static void rebuildForbiddenRangeIndex();
+
     /**
      * @brief 领地范围是否合法
      */
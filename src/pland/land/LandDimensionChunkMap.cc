@@ -1,6 +1,7 @@
 #include "LandDimensionChunkMap.h"
-#include "LandRegistry.h"
 #include "pland/infra/BidirectionalMap.h"
+#include <cstdlib>
+#include <ranges>
 
 namespace land {
 
@@ -42,27 +43,25 @@ std::unordered_set<ChunkID> const* LandDimensionChunkMap::queryChunk(LandDimid d
     return &mMap.at(dimId).at(landId);
 }
 
-void LandDimensionChunkMap::addLand(SharedLand const& land) {
-    auto landDimId = land->getDimensionId();
-    auto landId    = land->getId();
+void LandDimensionChunkMap::addLand(LandDimid dimId, LandID landId, LandAABB const& range) {
+    auto chunkIds =
+        range.getChunks() | std::views::transform([](auto& c) { return LandDimensionChunkMap::EncodeChunkID(c.x, c.z); });
 
-    auto chunkIds = land->getAABB().getChunks()
-                  | std::views::transform([](auto& c) { return LandRegistry::EncodeChunkID(c.x, c.z); });
-
-    auto& dim = mMap[landDimId];
+    auto& dim = mMap[dimId];
     for (auto chunkId : chunkIds) {
         dim.insert(chunkId, landId);
     }
 }
 
-void LandDimensionChunkMap::removeLand(SharedLand const& land) {
-    auto landDimId = land->getDimensionId();
-    auto landId    = land->getId();
+void LandDimensionChunkMap::addChunk(LandDimid dimId, ChunkID chunkId, LandID landId) {
+    mMap[dimId].insert(chunkId, landId);
+}
 
-    if (!mMap.contains(landDimId)) return;
+void LandDimensionChunkMap::removeLand(LandDimid dimId, LandID landId) {
+    if (!mMap.contains(dimId)) return;
 
-    auto& dim         = mMap.at(landDimId);
-    auto  chunkSetPtr = queryChunk(landDimId, landId);
+    auto& dim         = mMap.at(dimId);
+    auto  chunkSetPtr = queryChunk(dimId, landId);
     if (!chunkSetPtr) return;
 
     auto chunkSet = *chunkSetPtr;
@@ -71,14 +70,46 @@ void LandDimensionChunkMap::removeLand(SharedLand const& land) {
     }
 }
 
-void LandDimensionChunkMap::refreshRange(SharedLand const& land) {
-    auto landDimId = land->getDimensionId();
-    if (!mMap.contains(landDimId)) {
+void LandDimensionChunkMap::refreshRange(LandDimid dimId, LandID landId, LandAABB const& range) {
+    if (!mMap.contains(dimId)) {
         return;
     }
-    removeLand(land);
-    addLand(land);
+    removeLand(dimId, landId);
+    addLand(dimId, landId, range);
 }
 
+MemoryUsage LandDimensionChunkMap::estimateMemory() const {
+    MemoryUsage usage{"LandDimensionChunkMap"};
+    usage.bytes = mem_utils::heapBytes(mMap);
+    for (auto const& map : mMap | std::views::values) {
+        usage.bytes += mem_utils::heapBytes(map.left()) + mem_utils::heapBytes(map.right());
+        for (auto const& lands : map.left() | std::views::values) {
+            usage.count += lands.size();
+        }
+    }
+    return usage;
+}
+
+ChunkID LandDimensionChunkMap::EncodeChunkID(int x, int z) {
+    auto ux = static_cast<uint64_t>(std::abs(x));
+    auto uz = static_cast<uint64_t>(std::abs(z));
+
+    uint64_t signBits = 0;
+    if (x >= 0) signBits |= (1ULL << 63);
+    if (z >= 0) signBits |= (1ULL << 62);
+    return signBits | (ux << 31) | (uz & 0x7FFFFFFF);
+    // Memory layout:
+    // [signBits][x][z] (signBits: 2 bits, x: 31 bits, z: 31 bits)
+}
+std::pair<int, int> LandDimensionChunkMap::DecodeChunkID(ChunkID id) {
+    bool xPositive = (id & (1ULL << 63)) != 0;
+    bool zPositive = (id & (1ULL << 62)) != 0;
+
+    int x = static_cast<int>((id >> 31) & 0x7FFFFFFF);
+    int z = static_cast<int>(id & 0x7FFFFFFF);
+    if (!xPositive) x = -x;
+    if (!zPositive) z = -z;
+    return {x, z};
+}
 
 } // namespace land
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
-#include "Land.h"
 #include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
 #include "pland/infra/BidirectionalMap.h"
+#include "pland/utils/MemoryEstimate.h"
 #include <concepts>
 #include <cstdint>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 namespace land {
 
@@ -14,6 +17,7 @@ namespace land {
  *         / --> 区块 --> [领地]  # 查询领地
  * 维度 --|
  *        \ --> 领地 --> [区块]   # 查询区块
+ * @note 只依赖领地ID与范围，不依赖 Land / LandRegistry
  */
 class LandDimensionChunkMap {
 public:
@@ -47,11 +51,24 @@ class LandDimensionChunkMap {
      */
     LDNDAPI std::unordered_set<ChunkID> const* queryChunk(LandDimid dimId, LandID landId) const;
 
-    LDAPI void addLand(SharedLand const& land);
+    LDAPI void addLand(LandDimid dimId, LandID landId, LandAABB const& range);
 
-    LDAPI void removeLand(SharedLand const& land);
+    /**
+     * @brief 直接添加一条 (区块, 领地) 映射，用于从预先计算好的索引恢复
+     */
+    LDAPI void addChunk(LandDimid dimId, ChunkID chunkId, LandID landId);
+
+    LDAPI void removeLand(LandDimid dimId, LandID landId);
+
+    LDAPI void refreshRange(LandDimid dimId, LandID landId, LandAABB const& range);
+
+    /**
+     * @brief 估算内存占用，count 为 (区块, 领地) 映射条目数
+     */
+    LDNDAPI MemoryUsage estimateMemory() const;
 
-    LDAPI void refreshRange(SharedLand const& land);
+    LDAPI static ChunkID             EncodeChunkID(int x, int z);
+    LDAPI static std::pair<int, int> DecodeChunkID(ChunkID id);
 
 private:
     Map mMap;
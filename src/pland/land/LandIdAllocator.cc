@@ -8,5 +8,7 @@ LandIdAllocator::LandIdAllocator(LandID currentId) { mCurrentId.store(currentId)
 
 LandID LandIdAllocator::nextId() { return mCurrentId.fetch_add(1); }
 
+LandID LandIdAllocator::getCurrentId() const { return mCurrentId.load(); }
+
 
 } // namespace land
\ No newline at end of file
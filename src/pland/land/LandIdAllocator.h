@@ -11,6 +11,8 @@ class LandIdAllocator {
     LDAPI explicit LandIdAllocator(LandID currentId = 0);
 
     LDAPI LandID nextId();
+
+    LDNDAPI LandID getCurrentId() const; // 下一个将分配的ID
 };
 
 
@@ -0,0 +1,306 @@
+#include "pland/land/LandJournal.h"
+#include "pland/utils/Crc32.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef LD_BENCH
+#include "fmt/format.h" // 基准测试不依赖 LeviLamina，错误直接输出到 stderr
+#else
+#include "pland/PLand.h"
+#endif
+
+
+namespace land {
+
+
+namespace {
+
+template <typename T>
+void put(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template <typename T>
+T get(char const* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename... Args>
+void logError(fmt::format_string<Args...> format, Args&&... args) {
+#ifdef LD_BENCH
+    fmt::print(stderr, "{}\n", fmt::format(format, std::forward<Args>(args)...));
+#else
+    PLand::getInstance().getSelf().getLogger().error(format, std::forward<Args>(args)...);
+#endif
+}
+
+// 字段赋值记录，同一领地只需保留最后一次
+bool isAssignment(LandJournal::RecordType type) {
+    using enum LandJournal::RecordType;
+    return type != Upsert && type != Remove && type != AddMember && type != RemoveMember;
+}
+
+void encode(std::string& out, LandJournal::Record const& record) {
+    put(out, static_cast<uint32_t>(record.payload.size()));
+    auto crcPos = out.size();
+    put(out, uint32_t{0});
+
+    auto bodyPos = out.size();
+    put(out, record.seq);
+    put(out, static_cast<uint8_t>(record.type));
+    put(out, static_cast<int64_t>(record.landId));
+    out += record.payload;
+
+    auto crc = crc32::compute(out.data() + bodyPos, out.size() - bodyPos);
+    std::memcpy(out.data() + crcPos, &crc, sizeof(crc));
+}
+
+} // namespace
+
+
+LandJournal::LandJournal(std::filesystem::path file, std::chrono::milliseconds groupCommitInterval, bool syncToDisk)
+: mFile(std::move(file)),
+  mGroupCommitInterval(groupCommitInterval),
+  mSyncToDisk(syncToDisk) {
+    std::error_code ec;
+    std::filesystem::create_directories(mFile.parent_path(), ec);
+    auto size = std::filesystem::file_size(mFile, ec);
+    if (!ec) {
+        mWrittenBytes = size; // 上次未能检查点的记录，保留到下次启动重放
+    }
+    if (!open("ab")) {
+        logError("Failed to open land journal: {}", mFile.string());
+    }
+    mThread = std::thread([this]() { run(); });
+}
+
+LandJournal::~LandJournal() {
+    mStop = true;
+    mPendingCv.notify_all();
+    if (mThread.joinable()) mThread.join();
+    commit();
+    if (mHandle) {
+        std::fclose(mHandle);
+        mHandle = nullptr;
+    }
+}
+
+bool LandJournal::open(char const* mode) {
+#ifdef _WIN32
+    auto wmode = std::wstring(mode, mode + std::strlen(mode));
+    mHandle    = _wfopen(mFile.c_str(), wmode.c_str());
+#else
+    mHandle = std::fopen(mFile.c_str(), mode);
+#endif
+    return mHandle != nullptr;
+}
+
+std::filesystem::path const& LandJournal::getFile() const { return mFile; }
+
+LandJournal::ReadResult LandJournal::read(std::filesystem::path const& file) {
+    ReadResult result;
+
+    std::ifstream ifs(file, std::ios::binary);
+    if (!ifs) {
+        return result;
+    }
+    std::string data{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+
+    size_t pos = 0;
+    while (pos < data.size()) {
+        if (data.size() - pos < HeaderSize) {
+            result.tornTail = true;
+            break;
+        }
+        auto payloadSize = get<uint32_t>(data.data() + pos);
+        auto crc         = get<uint32_t>(data.data() + pos + 4);
+        if (data.size() - pos - HeaderSize < payloadSize) {
+            result.tornTail = true;
+            break;
+        }
+
+        auto body = data.data() + pos + 8;
+        if (crc32::compute(body, HeaderSize - 8 + payloadSize) != crc) {
+            result.tornTail = true;
+            break;
+        }
+
+        Record record;
+        record.seq    = get<uint64>(body);
+        record.type   = static_cast<RecordType>(get<uint8_t>(body + 8));
+        record.landId = static_cast<LandID>(get<int64_t>(body + 9));
+        record.payload.assign(body + 17, payloadSize);
+        result.records.push_back(std::move(record));
+
+        pos += HeaderSize + payloadSize;
+    }
+    return result;
+}
+
+void LandJournal::upsert(LandID id, std::string payload) { enqueue(id, RecordType::Upsert, std::move(payload)); }
+
+void LandJournal::remove(LandID id) { enqueue(id, RecordType::Remove, {}); }
+
+void LandJournal::update(LandID id, RecordType type, std::string payload) { enqueue(id, type, std::move(payload)); }
+
+void LandJournal::enqueue(LandID id, RecordType type, std::string payload) {
+    {
+        std::lock_guard lock(mPendingMutex);
+        auto&           seqs = mPendingIndex[id];
+        if (type == RecordType::Upsert || type == RecordType::Remove) {
+            for (auto seq : seqs) mPending.erase(seq); // 整个领地被覆盖，之前的记录都不再需要
+            seqs.clear();
+        } else if (isAssignment(type)) {
+            std::erase_if(seqs, [&](uint64 seq) {
+                auto iter = mPending.find(seq);
+                if (iter == mPending.end() || iter->second.type != type) return false;
+                mPending.erase(iter); // 只保留同一字段的最后一次赋值
+                return true;
+            });
+        }
+        auto seq = mNextSeq++;
+        seqs.push_back(seq);
+        mPending.emplace(seq, Record{seq, type, id, std::move(payload)});
+    }
+    mPendingCv.notify_one();
+}
+
+std::string LandJournal::encodeInts(std::initializer_list<int32_t> values) {
+    std::string out;
+    out.reserve(values.size() * sizeof(int32_t));
+    for (auto value : values) put(out, value);
+    return out;
+}
+
+bool LandJournal::decodeInts(std::string_view payload, std::span<int32_t> out) {
+    if (payload.size() != out.size() * sizeof(int32_t)) {
+        return false;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = get<int32_t>(payload.data() + i * sizeof(int32_t));
+    }
+    return true;
+}
+
+void LandJournal::run() {
+    std::unique_lock lock(mPendingMutex);
+    while (!mStop) {
+        mPendingCv.wait(lock, [this]() { return mStop || !mPending.empty(); });
+        if (mStop) break;
+
+        // 等待一个组提交间隔，收集这段时间内的其它变更
+        mPendingCv.wait_for(lock, mGroupCommitInterval, [this]() { return mStop.load(); });
+
+        lock.unlock();
+        commit();
+        lock.lock();
+    }
+}
+
+void LandJournal::commit() {
+    std::lock_guard fileLock(mFileMutex); // 先获取文件锁，保证批次按序号顺序写入
+
+    std::map<uint64, Record> batch;
+    {
+        std::lock_guard lock(mPendingMutex);
+        batch.swap(mPending);
+        mPendingIndex.clear();
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    std::string                            buffer;
+    std::vector<std::pair<uint64, uint64>> ends;
+    ends.reserve(batch.size());
+    for (auto const& record : batch | std::views::values) {
+        encode(buffer, record);
+        ends.emplace_back(record.seq, mWrittenBytes + buffer.size());
+    }
+
+    if (!mHandle || std::fwrite(buffer.data(), 1, buffer.size(), mHandle) != buffer.size()
+        || std::fflush(mHandle) != 0) {
+        // 领地仍为脏数据，下次保存时照常写入数据库，此处仅丢失崩溃保护
+        logError("Failed to write {} record(s) to land journal: {}", batch.size(), mFile.string());
+        return;
+    }
+    if (mSyncToDisk) {
+#ifdef _WIN32
+        _commit(_fileno(mHandle));
+#else
+        fsync(fileno(mHandle));
+#endif
+    }
+    mWrittenBytes += buffer.size();
+    mCommitted.insert(mCommitted.end(), ends.begin(), ends.end());
+}
+
+uint64 LandJournal::getLastSeq() {
+    std::lock_guard lock(mPendingMutex);
+    return mNextSeq - 1;
+}
+
+void LandJournal::flush() { commit(); }
+
+void LandJournal::checkpoint(uint64 seq) {
+    commit(); // 序号不大于 seq 的记录可能仍在队列中
+    std::lock_guard fileLock(mFileMutex);
+
+    // 记录按序号顺序写入，检查点位置为最后一条不大于 seq 的记录的结束位置
+    uint64 offset = mCheckpointOffset;
+    while (!mCommitted.empty() && mCommitted.front().first <= seq) {
+        offset = mCommitted.front().second;
+        mCommitted.pop_front();
+    }
+    if (offset <= mCheckpointOffset || !mHandle) {
+        return;
+    }
+
+    // 检查点之后提交的记录需要保留
+    std::string tail;
+    if (offset < mWrittenBytes) {
+        std::ifstream ifs(mFile, std::ios::binary);
+        ifs.seekg(static_cast<std::streamoff>(offset - mCheckpointOffset));
+        tail.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    std::fclose(mHandle);
+    mHandle = nullptr;
+
+    std::error_code ec;
+    if (tail.empty()) {
+        open("wb"); // 截断
+    } else {
+        auto tmp = std::filesystem::path{mFile}.concat(".tmp");
+        {
+            std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+            ofs.write(tail.data(), static_cast<std::streamsize>(tail.size()));
+        }
+        std::filesystem::rename(tmp, mFile, ec);
+        open("ab");
+    }
+    if (ec || !mHandle) {
+        logError("Failed to checkpoint land journal: {}", mFile.string());
+        if (!mHandle) open("ab");
+        return;
+    }
+    mCheckpointOffset = offset;
+}
+
+
+} // namespace land
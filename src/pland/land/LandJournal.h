@@ -0,0 +1,156 @@
+#pragma once
+#include "pland/Global.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 领地预写日志记录类型
+ * @note 只能追加，已有的值会出现在旧日志文件中
+ */
+enum class LandJournalRecord : uint8_t {
+    Upsert              = 1,  // 新增或结构变化(父子关系)，payload 为领地 JSON
+    Remove              = 2,  // 删除，payload 为空
+    SetOwner            = 3,  // payload 为主人 UUID
+    SetName             = 4,  // payload 为名称
+    SetDescribe         = 5,  // payload 为描述
+    AddMember           = 6,  // payload 为成员 UUID
+    RemoveMember        = 7,  // payload 为成员 UUID
+    SetPermTable        = 8,  // payload 为权限表 JSON
+    SetRange            = 9,  // payload 为 6 个 i32 (min.xyz, max.xyz)
+    SetTeleportPos      = 10, // payload 为 3 个 i32
+    SetOriginalBuyPrice = 11, // payload 为 1 个 i32
+};
+
+
+/**
+ * @brief 领地预写日志(WAL)
+ * 领地变更时在变更线程放入待提交队列，setter 只记录被修改的字段，新增与结构变化记录整个领地。
+ * 同一领地的 Upsert/Remove 会覆盖其之前的待提交记录，同一字段的赋值只保留最后一次(成员增删不合并)。
+ * 提交线程每隔 groupCommitInterval 将队列批量追加到日志文件(组提交)。
+ * 启动时由 LandRegistry 按序号重放日志并写入数据库，每次完整保存后丢弃已落库的记录(检查点)
+ *
+ * 记录格式(小端): [u32 payloadSize][u32 crc32][u64 seq][u8 type][i64 landId][payload]
+ * crc32 覆盖 seq 到 payload 末尾，读取时遇到不完整或校验失败的记录即停止
+ */
+class LandJournal final {
+public:
+    using RecordType = LandJournalRecord;
+
+    struct Record {
+        uint64      seq{0};
+        RecordType  type{RecordType::Upsert};
+        LandID      landId{-1};
+        std::string payload;
+    };
+
+    struct ReadResult {
+        std::vector<Record> records;
+        bool                tornTail{false}; // 末尾存在不完整或损坏的记录(已忽略)
+    };
+
+    static constexpr size_t HeaderSize = 4 + 4 + 8 + 1 + 8;
+
+    LD_DISALLOW_COPY_AND_MOVE(LandJournal);
+
+    /**
+     * @param file 日志文件，已存在时追加写入
+     * @param groupCommitInterval 组提交间隔
+     * @param syncToDisk 每次提交后是否同步到磁盘
+     */
+    LDAPI explicit LandJournal(
+        std::filesystem::path     file,
+        std::chrono::milliseconds groupCommitInterval,
+        bool                      syncToDisk
+    );
+
+    /**
+     * @brief 停止提交线程并提交剩余记录
+     */
+    LDAPI ~LandJournal();
+
+    /**
+     * @brief 读取日志中的所有有效记录
+     */
+    LDNDAPI static ReadResult read(std::filesystem::path const& file);
+
+    LDAPI void upsert(LandID id, std::string payload);
+
+    LDAPI void remove(LandID id);
+
+    /**
+     * @brief 记录单个字段的修改
+     * @param type Upsert、Remove 以外的记录类型
+     */
+    LDAPI void update(LandID id, RecordType type, std::string payload);
+
+    /**
+     * @brief 编码/解码定长整数 payload (SetRange、SetTeleportPos、SetOriginalBuyPrice)
+     * @return 解码时 payload 长度与 out 不符返回 false
+     */
+    LDNDAPI static std::string encodeInts(std::initializer_list<int32_t> values);
+    LDNDAPI static bool        decodeInts(std::string_view payload, std::span<int32_t> out);
+
+    /**
+     * @brief 最后一条记录的序号(含未提交的记录)
+     * @note 在复制领地数据前获取，数据落库后传给 checkpoint
+     */
+    LDNDAPI uint64 getLastSeq();
+
+    /**
+     * @brief 立即提交所有待提交记录
+     */
+    LDAPI void flush();
+
+    /**
+     * @brief 提交待提交记录，并丢弃序号不大于 seq 的记录(这些记录已写入数据库)
+     */
+    LDAPI void checkpoint(uint64 seq);
+
+    LDNDAPI std::filesystem::path const& getFile() const;
+
+private:
+    void run();
+    void commit();
+    bool open(char const* mode);
+    void enqueue(LandID id, RecordType type, std::string payload);
+
+    std::filesystem::path     mFile;
+    std::chrono::milliseconds mGroupCommitInterval;
+    bool                      mSyncToDisk;
+
+    std::mutex                                      mPendingMutex;
+    std::condition_variable                         mPendingCv;
+    std::map<uint64, Record>                        mPending;      // 序号 => 待提交记录
+    std::unordered_map<LandID, std::vector<uint64>> mPendingIndex; // 领地ID => 待提交记录序号(合并同一领地的变更)
+    uint64                                          mNextSeq{1};
+
+    std::mutex                            mFileMutex;
+    std::FILE*                            mHandle{nullptr};
+    std::deque<std::pair<uint64, uint64>> mCommitted;           // 已提交记录: 序号 => 结束位置(逻辑偏移)
+    uint64                                mWrittenBytes{0};     // 逻辑偏移: 累计写入字节数(含打开时已有的内容)
+    uint64                                mCheckpointOffset{0}; // 逻辑偏移: 文件起始位置
+    std::thread                           mThread;
+
+    std::atomic<bool> mStop{false};
+};
+
+
+} // namespace land
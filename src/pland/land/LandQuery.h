@@ -0,0 +1,186 @@
+#pragma once
+#include "mc/world/level/BlockPos.h"
+#include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/land/LandDimensionChunkMap.h"
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace land {
+
+
+/**
+ * @brief 领地空间查询的领地访问方式
+ * 需提供: static LandAABB const& aabb(T const&); static bool is3D(T const&); static int nestedLevel(T const&);
+ */
+template <typename T>
+struct LandQueryTraits;
+
+
+/**
+ * 领地空间查询核心(LandRegistry::getLandAt 的实现)
+ * 只依赖 LandDimensionChunkMap 与领地缓存，不依赖 LeviLamina，基准测试直接复用同一份实现
+ * @note 调用方负责加锁
+ */
+namespace land_query {
+
+template <typename Ptr>
+using Traits = LandQueryTraits<typename Ptr::element_type>;
+
+template <typename Ptr>
+using LandMap = std::unordered_map<LandID, Ptr>;
+
+/**
+ * @brief 遍历与区块范围相交的领地(每个区块只访问一次，领地可能被访问多次)
+ */
+template <typename Ptr, typename Fn>
+void forEachLandInChunks(
+    LandDimensionChunkMap const& chunkMap,
+    LandMap<Ptr> const&          lands,
+    LandDimid                    dimid,
+    int                          minChunkX,
+    int                          minChunkZ,
+    int                          maxChunkX,
+    int                          maxChunkZ,
+    Fn&&                         fn
+) {
+    std::unordered_set<ChunkID> visitedChunks; // 记录已访问的区块
+    for (int x = minChunkX; x <= maxChunkX; ++x) {
+        for (int z = minChunkZ; z <= maxChunkZ; ++z) {
+            ChunkID chunkId = LandDimensionChunkMap::EncodeChunkID(x, z);
+            if (!visitedChunks.insert(chunkId).second) {
+                continue; // 如果区块已经访问过，则跳过
+            }
+
+            auto landsIds = chunkMap.queryLand(dimid, chunkId);
+            if (!landsIds) {
+                continue;
+            }
+            for (auto const& id : *landsIds) {
+                if (auto iter = lands.find(id); iter != lands.end()) {
+                    fn(iter->second);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 查询包含某点的领地，多个领地重叠时返回嵌套层级最深的(子领地优先)
+ */
+template <typename Ptr>
+[[nodiscard]] Ptr
+landAt(LandDimensionChunkMap const& chunkMap, LandMap<Ptr> const& lands, BlockPos const& pos, LandDimid dimid) {
+    auto landsIds = chunkMap.queryLand(dimid, LandDimensionChunkMap::EncodeChunkID(pos.x >> 4, pos.z >> 4));
+    if (!landsIds) {
+        return nullptr;
+    }
+
+    Ptr    found    = nullptr;
+    size_t count    = 0;
+    int    maxLevel = -1;
+    for (auto const& id : *landsIds) {
+        auto iter = lands.find(id);
+        if (iter == lands.end()) {
+            continue;
+        }
+        auto const& land = iter->second;
+        if (!Traits<Ptr>::aabb(*land).hasPos(pos, !Traits<Ptr>::is3D(*land))) {
+            continue;
+        }
+        if (++count == 1) {
+            found = land; // 只有一个领地时(普通领地)无需计算嵌套层级
+            continue;
+        }
+        if (count == 2) {
+            maxLevel = Traits<Ptr>::nestedLevel(*found);
+        }
+        if (int level = Traits<Ptr>::nestedLevel(*land); level > maxLevel) {
+            maxLevel = level;
+            found    = land;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief 查询与以 center 为中心、radius 为半径的范围相交的领地(2D 领地忽略 Y 轴)
+ */
+template <typename Ptr>
+[[nodiscard]] std::unordered_set<Ptr> landsInRadius(
+    LandDimensionChunkMap const& chunkMap,
+    LandMap<Ptr> const&          lands,
+    BlockPos const&              center,
+    int                          radius,
+    LandDimid                    dimid
+) {
+    std::unordered_set<Ptr> result;
+    if (!chunkMap.hasDimension(dimid)) {
+        return result;
+    }
+    forEachLandInChunks<Ptr>(
+        chunkMap,
+        lands,
+        dimid,
+        (center.x - radius) >> 4,
+        (center.z - radius) >> 4,
+        (center.x + radius) >> 4,
+        (center.z + radius) >> 4,
+        [&](Ptr const& land) {
+            auto const& aabb = Traits<Ptr>::aabb(*land);
+            bool const  is3D = Traits<Ptr>::is3D(*land);
+            LandAABB    box{
+                LandPos{center.x - radius, is3D ? center.y - radius : aabb.min.y, center.z - radius},
+                LandPos{center.x + radius, is3D ? center.y + radius : aabb.max.y, center.z + radius}
+            };
+            if (LandAABB::isCollision(aabb, box)) {
+                result.insert(land);
+            }
+        }
+    );
+    return result;
+}
+
+/**
+ * @brief 查询与 pos1、pos2 构成的范围相交的领地
+ */
+template <typename Ptr>
+[[nodiscard]] std::unordered_set<Ptr> landsInRange(
+    LandDimensionChunkMap const& chunkMap,
+    LandMap<Ptr> const&          lands,
+    BlockPos const&              pos1,
+    BlockPos const&              pos2,
+    LandDimid                    dimid
+) {
+    std::unordered_set<Ptr> result;
+    if (!chunkMap.hasDimension(dimid)) {
+        return result;
+    }
+    LandAABB box{
+        LandPos{pos1.x, pos1.y, pos1.z},
+        LandPos{pos2.x, pos2.y, pos2.z}
+    };
+    forEachLandInChunks<Ptr>(
+        chunkMap,
+        lands,
+        dimid,
+        std::min(pos1.x, pos2.x) >> 4,
+        std::min(pos1.z, pos2.z) >> 4,
+        std::max(pos1.x, pos2.x) >> 4,
+        std::max(pos1.z, pos2.z) >> 4,
+        [&](Ptr const& land) {
+            if (LandAABB::isCollision(Traits<Ptr>::aabb(*land), box)) {
+                result.insert(land);
+            }
+        }
+    );
+    return result;
+}
+
+} // namespace land_query
+
+
+} // namespace land
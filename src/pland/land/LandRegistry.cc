@@ -1,20 +1,30 @@
 #include "LandRegistry.h"
 #include "LandCreateValidator.h"
 #include "fmt/core.h"
+#include "ll/api/coro/CoroTask.h"
 #include "ll/api/data/KeyValueDB.h"
 #include "ll/api/i18n/I18n.h"
+#include "ll/api/thread/ServerThreadExecutor.h"
 #include "mc/world/actor/player/Player.h"
 #include "mc/world/level/BlockPos.h"
 #include "nlohmann/json_fwd.hpp"
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/aabb/LandAABB.h"
+#include "pland/infra/Config.h"
+#include "pland/infra/SpanTracer.h"
+#include "pland/infra/StartupProfiler.h"
+#include "pland/infra/StringPool.h"
 #include "pland/land/Land.h"
 #include "pland/land/LandContext.h"
+#include "pland/land/LandJournal.h"
+#include "pland/land/LandQuery.h"
+#include "pland/land/LandSnapshot.h"
 #include "pland/land/LandTemplatePermTable.h"
 #include "pland/utils/JSON.h"
 #include "pland/utils/Utils.h"
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
@@ -22,15 +32,27 @@
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <random>
+#include <ranges>
 #include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 
 namespace land {
+
+template <>
+struct LandQueryTraits<Land> {
+    static LandAABB const& aabb(Land const& land) { return land.getAABB(); }
+    static bool            is3D(Land const& land) { return land.is3D(); }
+    static int             nestedLevel(Land const& land) { return land.getNestedLevel(); }
+};
+
 std::string PlayerSettings::SYSTEM_LOCALE_CODE() { return "system"; }
 std::string PlayerSettings::SERVER_LOCALE_CODE() { return "server"; }
 
@@ -147,7 +169,8 @@ void LandRegistry::_checkVersionAndTryAdaptBreakingChanges(nlohmann::json& landD
 }
 
 bool LandRegistry::isLandData(std::string_view key) {
-    return key != DbVersionKey && key != DbOperatorDataKey && key != DbPlayerSettingDataKey && key != DbTemplatePermKey;
+    return key != DbVersionKey && key != DbOperatorDataKey && key != DbPlayerSettingDataKey && key != DbTemplatePermKey
+        && key != DbSnapshotTokenKey && key != DbNextLandIdKey && !key.starts_with(DbEconomyLedgerKeyPrefix);
 }
 void LandRegistry::_loadLands() {
     ll::coro::Generator<std::pair<std::string_view, std::string_view>> iter = mDB->iter();
@@ -170,8 +193,72 @@ void LandRegistry::_loadLands() {
         mLandCache.emplace(land->getId(), std::move(land));
     }
 
-    mLandIdAllocator = std::make_unique<LandIdAllocator>(safeId); // 初始化ID分配器
+    _initLandIdAllocator(safeId);
 }
+bool LandRegistry::_loadLandsFromSnapshot() {
+    auto token = mDB->get(DbSnapshotTokenKey);
+    if (!token) {
+        return false; // 上次没有正常关服
+    }
+    mDB->del(DbSnapshotTokenKey); // 本次启动后的任何修改都会使快照过期
+    if (!Config::cfg.land.snapshot.enabled) {
+        return false;
+    }
+
+    auto& logger   = PLand::getInstance().getSelf().getLogger();
+    auto  snapshot = std::optional<LandSnapshot>{};
+    try {
+        snapshot = LandSnapshot::open(
+            PLand::getInstance().getSelf().getDataDir() / SnapshotFileName,
+            std::stoull(*token)
+        );
+    } catch (...) {}
+    if (!snapshot) {
+        logger.warn("启动快照无效或与数据库不匹配，将从数据库加载领地");
+        return false;
+    }
+
+    // 领地只记录其在映射中的位置，首次访问或由后台线程解析(见 _startSnapshotParser)
+    auto const shared = std::make_shared<LandSnapshot const>(std::move(*snapshot));
+    auto const count  = shared->landCount();
+
+    LandID safeId{0};
+    mLandCache.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto const& entry = shared->land(i);
+        if (safeId <= entry.id) {
+            safeId = entry.id + 1;
+        }
+        mLandCache.emplace(entry.id, Land::makeFromSnapshot(shared, shared->payload(entry)));
+    }
+    _initLandIdAllocator(safeId);
+
+    for (size_t i = 0; i < shared->chunkCount(); ++i) {
+        auto const& chunk = shared->chunk(i);
+        mDimensionChunkMap.addChunk(chunk.dimid, chunk.chunkId, chunk.landId);
+    }
+    return true;
+}
+
+void LandRegistry::_startSnapshotParser() {
+    std::vector<SharedLand> pending;
+    for (auto const& land : mLandCache | std::views::values) {
+        if (!land->mParsed.load(std::memory_order_acquire)) {
+            pending.push_back(land);
+        }
+    }
+    if (pending.empty()) {
+        return;
+    }
+    mSnapshotParseThread = std::thread([this, pending = std::move(pending)]() {
+        for (auto const& land : pending) {
+            if (mThreadStopFlag) return;
+            land->ensureParsed(); // 已被访问过的领地只有一次原子读取
+        }
+        PLand::getInstance().getSelf().getLogger().debug("启动快照中的 {} 块领地已在后台解析完成", pending.size());
+    });
+}
+
 void LandRegistry::_loadLandTemplatePermTable() {
     if (!mDB->has(DbTemplatePermKey)) {
         auto t = LandPermTable{};
@@ -197,26 +284,321 @@ void LandRegistry::_loadLandTemplatePermTable() {
     }
 }
 
+void LandRegistry::_initLandIdAllocator(LandID safeId) {
+    if (auto stored = mDB->get(DbNextLandIdKey)) {
+        try {
+            safeId = std::max(safeId, static_cast<LandID>(std::stoll(*stored)));
+        } catch (...) {}
+    }
+    mLandIdAllocator = std::make_unique<LandIdAllocator>(safeId);
+}
+
 void LandRegistry::_buildDimensionChunkMap() {
     for (auto& [id, land] : mLandCache) {
-        mDimensionChunkMap.addLand(land);
+        mDimensionChunkMap.addLand(land->getDimensionId(), land->getId(), land->getAABB());
+    }
+}
+
+bool LandRegistry::_replayJournal() {
+    auto&      logger = PLand::getInstance().getSelf().getLogger();
+    auto const file   = PLand::getInstance().getSelf().getDataDir() / JournalFileName;
+
+    auto result = LandJournal::read(file);
+    if (result.tornTail) {
+        logger.warn("领地预写日志末尾存在不完整的记录(可能是写入时崩溃)，已忽略");
+    }
+    if (result.records.empty()) {
+        return false;
+    }
+
+    bool                       applied = true;
+    std::unordered_set<LandID> touched; // 被修改的领地，重放结束后整体写入数据库
+    for (auto& record : result.records) {
+        try {
+            switch (record.type) {
+            case LandJournal::RecordType::Remove: {
+                mLandCache.erase(record.landId);
+                touched.erase(record.landId);
+                auto key = std::to_string(record.landId);
+                if (mDB->has(key) && !mDB->del(key)) applied = false;
+                break;
+            }
+            case LandJournal::RecordType::Upsert: {
+                auto json = JSON::parse(record.payload);
+                _checkVersionAndTryAdaptBreakingChanges(json);
+
+                auto land = Land::make();
+                land->load(json);
+                if (land->getId() != record.landId) {
+                    throw std::runtime_error("land id mismatch");
+                }
+                mLandCache.insert_or_assign(record.landId, std::move(land));
+                touched.insert(record.landId);
+                break;
+            }
+            default: {
+                auto iter = mLandCache.find(record.landId);
+                if (iter == mLandCache.end()) {
+                    break; // 领地已被删除
+                }
+                if (!_applyJournalRecord(*iter->second, record)) {
+                    throw std::runtime_error("invalid record");
+                }
+                touched.insert(record.landId);
+                break;
+            }
+            }
+        } catch (std::exception const& e) {
+            applied = false;
+            logger.error("重放领地预写日志失败, ID: {}, 错误: {}", record.landId, e.what());
+        }
+    }
+    for (auto id : touched) {
+        auto const& land = mLandCache.at(id);
+        land->mDirtyCounter.increment(); // 写入失败或之后的检查点都不会丢失重放的修改，下次保存时再次写入
+        if (!mDB->set(std::to_string(id), land->dump().dump())) applied = false;
+    }
+
+    // 重放可能新增了领地(或删除了崩溃前才分配的领地)，重新确定ID分配器的起点
+    LandID safeId{0};
+    for (auto const& id : mLandCache | std::views::keys) {
+        if (safeId <= id) safeId = id + 1;
+    }
+    for (auto const& record : result.records) {
+        if (safeId <= record.landId) safeId = record.landId + 1;
+    }
+    _initLandIdAllocator(safeId);
+
+    logger.warn("已从领地预写日志恢复 {} 条领地变更", result.records.size());
+    if (applied) {
+        std::error_code ec;
+        fs::remove(file, ec); // 已全部写入数据库(检查点)
+    }
+    return true;
+}
+
+bool LandRegistry::_applyJournalRecord(Land& land, LandJournal::Record const& record) {
+    land.ensureParsed();
+    using Type    = LandJournal::RecordType;
+    auto& context = land.mContext;
+    switch (record.type) {
+    case Type::SetOwner:
+        land.mOwner = InternedString{record.payload};
+        return true;
+    case Type::SetName:
+        land.mName = InternedString{record.payload};
+        return true;
+    case Type::SetDescribe:
+        land.mDescribe = InternedString{record.payload};
+        return true;
+    case Type::AddMember:
+        context.mLandMembers.push_back(record.payload);
+        return true;
+    case Type::RemoveMember:
+        std::erase(context.mLandMembers, record.payload);
+        return true;
+    case Type::SetPermTable: {
+        auto json = JSON::parse(record.payload);
+        JSON::jsonToStructTryPatch(json, context.mLandPermTable);
+        return true;
+    }
+    case Type::SetRange: {
+        std::array<int32_t, 6> v{};
+        if (!LandJournal::decodeInts(record.payload, v)) return false;
+        context.mPos = LandAABB{
+            LandPos{v[0], v[1], v[2]},
+            LandPos{v[3], v[4], v[5]}
+        };
+        return true;
+    }
+    case Type::SetTeleportPos: {
+        std::array<int32_t, 3> v{};
+        if (!LandJournal::decodeInts(record.payload, v)) return false;
+        context.mTeleportPos = LandPos{v[0], v[1], v[2]};
+        return true;
+    }
+    case Type::SetOriginalBuyPrice: {
+        std::array<int32_t, 1> v{};
+        if (!LandJournal::decodeInts(record.payload, v)) return false;
+        context.mOriginalBuyPrice = v[0];
+        return true;
+    }
+    default:
+        return false; // 未知的记录类型(更新版本写入的日志)
+    }
+}
+
+void LandRegistry::_journalUpsert(Land const& land) {
+    if (mJournal) mJournal->upsert(land.getId(), land.dump().dump());
+}
+
+void LandRegistry::_journalRemove(LandID id) {
+    if (mJournal) mJournal->remove(id);
+}
+
+void LandRegistry::_onLandModified(Land const& land, LandJournalRecord record, std::string payload) {
+    if (!mJournal) return;
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    auto                                iter = mLandCache.find(land.getId());
+    if (iter == mLandCache.end() || iter->second.get() != &land) {
+        return; // 已移除的领地不再记录
+    }
+    if (record == LandJournalRecord::Upsert) {
+        _journalUpsert(land);
+    } else {
+        mJournal->update(land.getId(), record, std::move(payload));
+    }
+}
+
+std::optional<LandContext> LandRegistry::_readLandContext(LandID id) const {
+    auto raw = mDB->get(std::to_string(id));
+    if (!raw) {
+        return std::nullopt;
+    }
+    try {
+        auto json = JSON::parse(*raw);
+        _checkVersionAndTryAdaptBreakingChanges(json);
+
+        LandContext context;
+        JSON::jsonToStruct(json, context);
+        return context;
+    } catch (std::exception const& e) {
+        PLand::getInstance().getSelf().getLogger().error("读取领地数据失败, ID: {}, 错误: {}", id, e.what());
+        return std::nullopt;
+    }
+}
+
+void LandRegistry::_requestLandDetail(LandID id, uint32_t generation) const {
+    {
+        std::lock_guard queueLock(mLazyLoad.mutex);
+        mLazyLoad.queue.emplace_back(id, generation);
+    }
+    mLazyLoad.cv.notify_one();
+}
+
+void LandRegistry::_startLazyLoader() {
+    auto& logger = PLand::getInstance().getSelf().getLogger();
+
+    size_t evicted = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mMutex);
+        for (auto const& land : mLandCache | std::views::values) {
+            evicted += land->evict(); // 启动快照中尚未解析的领地由换出协程稍后处理
+        }
+    }
+    logger.info("懒加载已启用，{} 块领地的名称、描述与成员将在附近区块加载或首次访问时读取", evicted);
+
+    mLazyLoad.thread = std::thread([this]() {
+        while (true) {
+            std::vector<std::pair<LandID, uint32_t>> batch;
+            {
+                std::unique_lock queueLock(mLazyLoad.mutex);
+                mLazyLoad.cv.wait(queueLock, [this]() { return mThreadStopFlag.load() || !mLazyLoad.queue.empty(); });
+                if (mThreadStopFlag) break;
+                batch.swap(mLazyLoad.queue);
+            }
+
+            std::vector<std::tuple<LandID, uint32_t, std::optional<LandContext>>> loaded;
+            loaded.reserve(batch.size());
+            for (auto const& [id, generation] : batch) {
+                loaded.emplace_back(id, generation, _readLandContext(id));
+            }
+
+            // 在服务器线程装入，权限判断读取这些字段时不需要加锁
+            ll::coro::keepThis([loaded = std::move(loaded)]() mutable -> ll::coro::CoroTask<> {
+                auto registry = PLand::getInstance().getLandRegistry();
+                if (!registry) {
+                    co_return; // 注册表已销毁
+                }
+                for (auto& [id, generation, detail] : loaded) {
+                    auto land = registry->getLand(id);
+                    if (!land) {
+                        continue; // 已被移除
+                    }
+                    if (detail) {
+                        land->installDetail(generation, std::move(*detail));
+                    } else if (generation == land->mResidentGeneration) {
+                        land->mLoadRequested = false; // 读取失败，允许再次请求
+                    }
+                }
+                co_return;
+            }).launch(ll::thread::ServerThreadExecutor::getDefault());
+        }
+    });
+
+    // 区块加载时预取其中的领地，玩家附近的预取由 LandScheduler 处理
+    mLazyLoad.chunkLoadHook = ChunkLoadHook::subscribe([this](LandDimid dimId, int chunkX, int chunkZ) {
+        prefetchLands(dimId, chunkX, chunkZ);
+    });
+
+    // 每分钟一轮，换出长时间未访问的领地
+    mEvictSleep = std::make_shared<ll::coro::InterruptableSleep>();
+    ll::coro::keepThis([quit = mAutoSaveQuit, sleep = mEvictSleep, this]() -> ll::coro::CoroTask<> {
+        while (!quit->load()) {
+            co_await sleep->sleepFor(std::chrono::minutes{1});
+            if (quit->load()) {
+                break;
+            }
+            ++Land::sAccessEpoch;
+            _evictIdleLands();
+        }
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
+}
+
+void LandRegistry::_evictIdleLands() {
+    LD_TRACE_SPAN("LandRegistry::evictIdleLands");
+    auto const idle = static_cast<uint32_t>(std::max(Config::cfg.land.lazyLoad.evictAfterMinutes, 1));
+
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    for (auto const& land : mLandCache | std::views::values) {
+        if (Land::sAccessEpoch - land->mLastAccessEpoch >= idle) {
+            land->evict();
+        }
+    }
+}
+
+void LandRegistry::prefetchLands(LandDimid dimid, int chunkX, int chunkZ, int radius) const {
+    if (!mLazyLoad.thread.joinable()) {
+        return; // 未启用懒加载
+    }
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    for (int x = chunkX - radius; x <= chunkX + radius; ++x) {
+        for (int z = chunkZ - radius; z <= chunkZ + radius; ++z) {
+            auto ids = mDimensionChunkMap.queryLand(dimid, EncodeChunkID(x, z));
+            if (!ids) {
+                continue;
+            }
+            for (auto id : *ids) {
+                if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
+                    iter->second->touch();
+                    iter->second->requestResident();
+                }
+            }
+        }
     }
 }
 
 LandID LandRegistry::getNextLandID() const { return mLandIdAllocator->nextId(); }
 
 Result<void, StorageLayerError::Error> LandRegistry::_removeLand(SharedLand const& ptr) {
-    mDimensionChunkMap.removeLand(ptr);
+    auto rootId = _findRootLandId(*ptr);
+    _invalidateFamilyIndex(rootId, rootId == ptr->getId());
+    mDimensionChunkMap.removeLand(ptr->getDimensionId(), ptr->getId());
     if (!mLandCache.erase(ptr->getId())) {
-        mDimensionChunkMap.addLand(ptr);
+        mDimensionChunkMap.addLand(ptr->getDimensionId(), ptr->getId(), ptr->getAABB());
         return std::unexpected(StorageLayerError::Error::STLMapError);
     }
 
-    if (!this->mDB->del(std::to_string(ptr->getId()))) {
-        mLandCache.emplace(ptr->getId(), ptr); // rollback
-        mDimensionChunkMap.addLand(ptr);
-        return std::unexpected(StorageLayerError::Error::DBError);
+    {
+        std::lock_guard saveLock(mSaveState.writeMutex); // 等待正在进行的保存，避免其写回已删除的领地
+        if (!this->mDB->del(std::to_string(ptr->getId()))) {
+            mLandCache.emplace(ptr->getId(), ptr); // rollback
+            mDimensionChunkMap.addLand(ptr->getDimensionId(), ptr->getId(), ptr->getAABB());
+            return std::unexpected(StorageLayerError::Error::DBError);
+        }
+        mSaveState.removedLands[ptr->getId()] = mSaveState.version;
     }
+    _journalRemove(ptr->getId());
     return {};
 }
 
@@ -225,72 +607,255 @@ Result<void, StorageLayerError::Error> LandRegistry::_removeLand(SharedLand cons
 
 namespace land {
 
-void LandRegistry::save() {
+LandRegistry::SaveSnapshot LandRegistry::_takeSaveSnapshot() const {
+    LD_TRACE_SPAN("LandRegistry::takeSaveSnapshot");
     std::shared_lock<std::shared_mutex> lock(mMutex); // 获取锁
-    mDB->set(DbOperatorDataKey, JSON::stringify(JSON::structTojson(mLandOperators)));
 
-    mDB->set(DbPlayerSettingDataKey, JSON::stringify(JSON::structTojson(mPlayerSettings)));
+    SaveSnapshot snapshot;
+    snapshot.version = ++mSaveState.version;
+    if (mJournal) {
+        snapshot.journalSeq = mJournal->getLastSeq(); // 先于复制，此前的变更都包含在快照中
+    }
 
+    snapshot.nextLandId     = mLandIdAllocator->getCurrentId();
+    snapshot.operators      = mLandOperators;
+    snapshot.playerSettings = mPlayerSettings;
     if (mLandTemplatePermTable->mDirtyCounter.isDirty()) {
-        if (mDB->set(DbTemplatePermKey, JSON::structTojson(mLandTemplatePermTable->mTemplatePermTable).dump())) {
-            mLandTemplatePermTable->mDirtyCounter.reset();
-        }
+        snapshot.templatePermTable.emplace(
+            mLandTemplatePermTable->mTemplatePermTable,
+            mLandTemplatePermTable->mDirtyCounter.getCounter()
+        );
     }
 
     for (auto const& land : mLandCache | std::views::values) {
-        land->save();
+        if (!land->isDirty()) continue;
+        if (!land->ensureResident()) continue; // 父子关系变化不会加载被换出的字段；读取失败时保持脏状态，下次重试
+        snapshot.lands.push_back({land, land->makeContext(), land->mDirtyCounter.getCounter()});
     }
+    return snapshot;
+}
+
+bool LandRegistry::_writeSaveSnapshot(SaveSnapshot const& snapshot) {
+    LD_TRACE_SPAN("LandRegistry::writeSaveSnapshot");
+    std::lock_guard lock(mSaveState.writeMutex);
+    if (snapshot.version < mSaveState.writtenVersion) {
+        return false; // 已写入更新的快照
+    }
+    mSaveState.writtenVersion = snapshot.version;
+
+    // 记录分配进度，领地删除后其ID也不会被复用(经济账本的幂等键依赖领地ID)
+    mDB->set(DbNextLandIdKey, std::to_string(snapshot.nextLandId));
+
+    mDB->set(DbOperatorDataKey, JSON::stringify(JSON::structTojson(snapshot.operators)));
+
+    mDB->set(DbPlayerSettingDataKey, JSON::stringify(JSON::structTojson(snapshot.playerSettings)));
+
+    if (auto const& table = snapshot.templatePermTable) {
+        if (mDB->set(DbTemplatePermKey, JSON::structTojson(table->first).dump())) {
+            mLandTemplatePermTable->mDirtyCounter.resetIfUnchanged(table->second);
+        }
+    }
+
+    bool allSaved = true;
+    for (auto const& entry : snapshot.lands) {
+        if (mSaveState.removedLands.contains(entry.context.mLandID)) {
+            continue; // 复制后已被移除
+        }
+        if (mDB->set(std::to_string(entry.context.mLandID), JSON::structTojson(entry.context).dump())) {
+            entry.land->mDirtyCounter.resetIfUnchanged(entry.dirtyCounter); // 复制后再次修改的领地保持脏状态
+        } else {
+            allSaved = false;
+        }
+    }
+    // 之后写入的快照都晚于这些移除操作，不会再包含这些领地
+    std::erase_if(mSaveState.removedLands, [&](auto const& pair) { return pair.second <= snapshot.version; });
+
+    if (snapshot.journalSeq && allSaved) {
+        mJournal->checkpoint(*snapshot.journalSeq); // 任一领地写入失败时保留日志，下次启动重放
+    }
+    return allSaved;
+}
+
+void LandRegistry::save() {
+    LD_TRACE_SPAN("LandRegistry::save");
+    _writeSaveSnapshot(_takeSaveSnapshot());
 }
 
 bool LandRegistry::save(Land const& land) const { return mDB->set(std::to_string(land.getId()), land.dump().dump()); }
 
+void LandRegistry::writeStartupSnapshot() const {
+    if (!Config::cfg.land.snapshot.enabled) {
+        return;
+    }
+    auto& logger = PLand::getInstance().getSelf().getLogger();
+
+    std::vector<LandSnapshot::Source> lands;
+    {
+        std::shared_lock<std::shared_mutex> lock(mMutex);
+        lands.reserve(mLandCache.size());
+        for (auto const& land : mLandCache | std::views::values) {
+            if (land->isDirty()) {
+                logger.warn("存在未保存的领地，跳过写出启动快照");
+                return;
+            }
+            if (!land->mResident) {
+                // 被换出的领地未修改，直接使用数据库中的数据，避免为写快照加载全部领地
+                auto payload = mDB->get(std::to_string(land->getId()));
+                if (!payload) {
+                    logger.warn("读取领地数据失败，跳过写出启动快照");
+                    return;
+                }
+                lands.push_back({land->getId(), land->getDimensionId(), land->getAABB(), std::move(*payload)});
+                continue;
+            }
+            lands.push_back({land->getId(), land->getDimensionId(), land->getAABB(), land->dump().dump()});
+        }
+    }
+    // 此时所有领地都已解析，不再引用旧快照的映射，可以覆盖文件
+
+    std::random_device rd;
+    auto const         token = (static_cast<uint64>(rd()) << 32) | rd();
+    if (!LandSnapshot::write(PLand::getInstance().getSelf().getDataDir() / SnapshotFileName, token, lands)) {
+        logger.warn("写出启动快照失败");
+        return;
+    }
+    mDB->set(DbSnapshotTokenKey, std::to_string(token)); // 快照完整写出后才写入令牌
+    logger.debug("启动快照已写出，共 {} 块领地", lands.size());
+}
+
 LandRegistry::LandRegistry() {
-    auto& logger = land::PLand::getInstance().getSelf().getLogger();
+    auto& logger   = land::PLand::getInstance().getSelf().getLogger();
+    auto& profiler = StartupProfiler::getInstance();
 
     logger.trace("打开数据库...");
-    _connectDatabaseAndCheckVersion();
+    {
+        auto phase = profiler.phase("Database open & version check");
+        _connectDatabaseAndCheckVersion();
+    }
 
     auto lock = std::unique_lock<std::shared_mutex>(mMutex);
     logger.trace("加载操作员...");
-    _loadOperators();
+    {
+        auto phase = profiler.phase("Operators");
+        _loadOperators();
+    }
     logger.info("已加载 {} 位操作员", mLandOperators.size());
 
     logger.trace("加载玩家设置...");
-    _loadPlayerSettings();
+    {
+        auto phase = profiler.phase("Player settings");
+        _loadPlayerSettings();
+    }
     logger.info("已加载 {} 位玩家的设置", mPlayerSettings.size());
 
     logger.trace("加载领地数据...");
-    _loadLands();
-    logger.info("已加载 {} 块领地数据", mLandCache.size());
+    bool fromSnapshot = false;
+    {
+        auto phase   = profiler.phase("Lands");
+        fromSnapshot = _loadLandsFromSnapshot();
+        if (!fromSnapshot) {
+            _loadLands();
+        }
+    }
+    if (fromSnapshot) {
+        logger.info("已从启动快照加载 {} 块领地数据", mLandCache.size());
+    } else {
+        logger.info("已加载 {} 块领地数据", mLandCache.size());
+    }
+
+    bool replayed = false;
+    {
+        auto phase = profiler.phase("Journal replay");
+        replayed   = _replayJournal();
+    }
 
     logger.trace("加载模板权限表...");
-    _loadLandTemplatePermTable();
+    {
+        auto phase = profiler.phase("Template perm table");
+        _loadLandTemplatePermTable();
+    }
     logger.info("已加载模板权限表");
 
-    logger.trace("构建维度区块映射...");
-    _buildDimensionChunkMap();
+    if (!fromSnapshot || replayed) {
+        logger.trace("构建维度区块映射...");
+        auto phase         = profiler.phase("Dimension chunk map");
+        mDimensionChunkMap = LandDimensionChunkMap{}; // 快照中的索引已过期
+        _buildDimensionChunkMap();
+    }
     logger.info("初始化维度区块映射完成");
 
+    if (fromSnapshot) {
+        _startSnapshotParser();
+    }
+
+    if (auto const& journal = Config::cfg.land.journal; journal.enabled) {
+        mJournal = std::make_unique<LandJournal>(
+            PLand::getInstance().getSelf().getDataDir() / JournalFileName,
+            std::chrono::milliseconds{std::max(journal.groupCommitIntervalMs, 0)},
+            journal.syncToDisk
+        );
+    }
+
     lock.unlock();
     mThread = std::thread([this]() {
-        static std::time_t lastSaveTime = std::time(nullptr);
-        while (!mThreadStopFlag) {
-            std::this_thread::sleep_for(std::chrono::seconds(5)); // 5秒检查一次 & 2分钟保存一次
-            if (std::time(nullptr) - lastSaveTime < 120) continue;
-            lastSaveTime = std::time(nullptr); // 更新时间
-
-            if (!mThreadStopFlag) {
-                land::PLand::getInstance().getSelf().getLogger().debug("[Thread] Saving land data...");
-                this->save();
-                land::PLand::getInstance().getSelf().getLogger().debug("[Thread] Land data saved.");
-            } else break;
+        while (true) {
+            SaveSnapshot snapshot;
+            {
+                std::unique_lock queueLock(mSaveState.queueMutex);
+                mSaveState.queueCv.wait(queueLock, [this]() {
+                    return mThreadStopFlag.load() || mSaveState.queued.has_value();
+                });
+                if (mThreadStopFlag) break;
+                snapshot = std::move(*mSaveState.queued);
+                mSaveState.queued.reset();
+            }
+            land::PLand::getInstance().getSelf().getLogger().debug("[Thread] Saving land data...");
+            _writeSaveSnapshot(snapshot);
+            land::PLand::getInstance().getSelf().getLogger().debug("[Thread] Land data saved.");
         }
     });
+
+    // 每 2 分钟在服务器线程复制一次脏数据，交给保存线程写入
+    mAutoSaveQuit  = std::make_shared<std::atomic<bool>>(false);
+    mAutoSaveSleep = std::make_shared<ll::coro::InterruptableSleep>();
+    ll::coro::keepThis([quit = mAutoSaveQuit, sleep = mAutoSaveSleep, this]() -> ll::coro::CoroTask<> {
+        while (!quit->load()) {
+            co_await sleep->sleepFor(std::chrono::minutes{2});
+            if (quit->load()) {
+                break;
+            }
+
+            auto snapshot = _takeSaveSnapshot();
+            {
+                std::lock_guard queueLock(mSaveState.queueMutex);
+                mSaveState.queued = std::move(snapshot); // 旧快照未写完时直接替换，其中的脏领地仍在新快照中
+            }
+            mSaveState.queueCv.notify_one();
+        }
+    }).launch(ll::thread::ServerThreadExecutor::getDefault());
+
+    if (Config::cfg.land.lazyLoad.enabled) {
+        _startLazyLoader();
+    }
 }
 
 LandRegistry::~LandRegistry() {
-    mThreadStopFlag = true;
+    mAutoSaveQuit->store(true);
+    mAutoSaveSleep->interrupt(true);
+    if (mEvictSleep) mEvictSleep->interrupt(true);
+    if (mLazyLoad.chunkLoadHook) ChunkLoadHook::unsubscribe(mLazyLoad.chunkLoadHook);
+    {
+        std::lock_guard queueLock(mSaveState.queueMutex);
+        mThreadStopFlag = true;
+    }
+    mSaveState.queueCv.notify_all();
+    {
+        std::lock_guard lazyLock(mLazyLoad.mutex); // 与加载线程的等待条件同步，避免错过通知
+    }
+    mLazyLoad.cv.notify_all();
     if (mThread.joinable()) mThread.join();
+    if (mLazyLoad.thread.joinable()) mLazyLoad.thread.join();
+    if (mSnapshotParseThread.joinable()) mSnapshotParseThread.join();
 }
 
 bool LandRegistry::isOperator(UUIDs const& uuid) const {
@@ -374,13 +939,16 @@ Result<void, StorageLayerError::Error> LandRegistry::_addLand(SharedLand land) {
         return std::unexpected(StorageLayerError::Error::STLMapError);
     }
 
-    mDimensionChunkMap.addLand(land);
+    mDimensionChunkMap.addLand(land->getDimensionId(), land->getId(), land->getAABB());
+    _journalUpsert(*land);
 
     return {};
 }
 void LandRegistry::refreshLandRange(SharedLand const& ptr) {
     std::unique_lock<std::shared_mutex> lock(mMutex);
-    mDimensionChunkMap.refreshRange(ptr);
+    mDimensionChunkMap.refreshRange(ptr->getDimensionId(), ptr->getId(), ptr->getAABB());
+    ++ptr->mRangeVersion;
+    _invalidateFamilyIndex(_findRootLandId(*ptr));
 }
 
 Result<void, StorageLayerError::Error> LandRegistry::addOrdinaryLand(SharedLand const& land) {
@@ -410,6 +978,9 @@ Result<void, StorageLayerError::Error> LandRegistry::addSubLand(SharedLand const
     sub->mContext.mParentLandID = parent->getId();
     parent->mDirtyCounter.increment();
     sub->mDirtyCounter.increment();
+    _invalidateFamilyIndex(_findRootLandId(*parent));
+    _journalUpsert(*parent);
+    _journalUpsert(*sub);
     return {};
 }
 
@@ -458,6 +1029,8 @@ Result<void, StorageLayerError::Error> LandRegistry::removeSubLand(SharedLand co
     if (!result.has_value()) {
         parent->mContext.mSubLandIDs.push_back(ptr->getId()); // 恢复父领地的子领地列表
         parent->mDirtyCounter.decrement();
+    } else {
+        _journalUpsert(*parent);
     }
 
     return result;
@@ -500,16 +1073,24 @@ Result<void, StorageLayerError::Error> LandRegistry::removeLandAndSubLands(Share
             // rollback
             for (auto land : removedLands) {
                 mLandCache.emplace(land->getId(), land);
-                mDimensionChunkMap.addLand(land);
+                mDimensionChunkMap.addLand(land->getDimensionId(), land->getId(), land->getAABB());
+                land->mDirtyCounter.increment(); // 数据库中的记录已删除，需重新写入
+                _journalUpsert(*land);
+                std::lock_guard saveLock(mSaveState.writeMutex);
+                mSaveState.removedLands.erase(land->getId());
             }
             if (parent) {
                 parent->mContext.mSubLandIDs.push_back(currentId); // 恢复父领地的子领地列表
                 parent->mDirtyCounter.decrement();
             }
+            _invalidateFamilyIndex(_findRootLandId(*ptr));
             // return std::unexpected("remove land or sub land failed!");
             return result;
         }
     }
+    if (parent) {
+        _journalUpsert(*parent);
+    }
     return {};
 }
 Result<void, StorageLayerError::Error> LandRegistry::removeLandAndPromoteSubLands(SharedLand const& ptr) {
@@ -535,6 +1116,10 @@ Result<void, StorageLayerError::Error> LandRegistry::removeLandAndPromoteSubLand
             subLand->mContext.mParentLandID = currentId;
             subLand->mDirtyCounter.decrement();
         }
+    } else {
+        for (auto& subLand : subLands) {
+            _journalUpsert(*subLand);
+        }
     }
     return result;
 }
@@ -575,6 +1160,11 @@ Result<void, StorageLayerError::Error> LandRegistry::removeLandAndTransferSubLan
         }
         parent->mContext.mSubLandIDs.push_back(currentId); // 恢复父领地的子领地列表
         parent->mDirtyCounter.decrement();
+    } else {
+        for (auto& subLand : subLands) {
+            _journalUpsert(*subLand);
+        }
+        _journalUpsert(*parent);
     }
 
     return result;
@@ -586,6 +1176,7 @@ WeakLand LandRegistry::getLandWeakPtr(LandID id) const {
 
     auto landIt = mLandCache.find(id);
     if (landIt != mLandCache.end()) {
+        landIt->second->ensureParsed();
         return {landIt->second};
     }
     return {}; // 返回一个空的weak_ptr
@@ -595,6 +1186,7 @@ SharedLand LandRegistry::getLand(LandID id) const {
 
     auto landIt = mLandCache.find(id);
     if (landIt != mLandCache.end()) {
+        landIt->second->ensureParsed(); // 从启动快照加载的领地在首次获取时解析
         return landIt->second;
     }
     return nullptr;
@@ -605,6 +1197,7 @@ std::vector<SharedLand> LandRegistry::getLands() const {
     std::vector<SharedLand> lands;
     lands.reserve(mLandCache.size());
     for (auto& land : mLandCache) {
+        land.second->ensureParsed();
         lands.push_back(land.second);
     }
     return lands;
@@ -615,6 +1208,7 @@ std::vector<SharedLand> LandRegistry::getLands(std::vector<LandID> const& ids) c
     std::vector<SharedLand> lands;
     for (auto id : ids) {
         if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
+            iter->second->ensureParsed();
             lands.push_back(iter->second);
         }
     }
@@ -691,121 +1285,143 @@ LandPermType LandRegistry::getPermType(UUIDs const& uuid, LandID id, bool ignore
 }
 
 
-SharedLand LandRegistry::getLandAt(BlockPos const& pos, LandDimid dimid) const {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
-    std::unordered_set<SharedLand>      result;
+LandID LandRegistry::_findRootLandId(Land const& land) const {
+    auto id = land.getId();
+    for (auto parentId = land.mContext.mParentLandID; parentId != LandID(-1);) {
+        auto iter = mLandCache.find(parentId);
+        if (iter == mLandCache.end()) {
+            break; // 父领地已移除(如级联删除过程中)
+        }
+        iter->second->ensureParsed();
+        id       = parentId;
+        parentId = iter->second->mContext.mParentLandID;
+    }
+    return id;
+}
+
+void LandRegistry::_invalidateFamilyIndex(LandID rootId, bool rootRemoved) const {
+    std::lock_guard<std::mutex> lock(mFamilyIndexCache.mutex);
+    auto                        iter = mFamilyIndexCache.entries.find(rootId);
+    if (iter == mFamilyIndexCache.entries.end()) {
+        return;
+    }
+    if (rootRemoved) {
+        mFamilyIndexCache.entries.erase(iter); // 进行中的构建找不到条目，不会写回
+        return;
+    }
+    iter->second.index.reset();
+    ++iter->second.version;
+}
 
-    auto landsIds = mDimensionChunkMap.queryLand(dimid, EncodeChunkID(pos.x >> 4, pos.z >> 4));
-    if (!landsIds) {
+std::shared_ptr<LandFamilyIndex const> LandRegistry::getFamilyIndex(SharedLand const& root) const {
+    if (!root) {
         return nullptr;
     }
+    LandID rootId{0};
+    bool   registered{false};
+    {
+        std::shared_lock<std::shared_mutex> lock(mMutex);
+        rootId     = _findRootLandId(*root); // 按真正的根领地缓存，失效时才能命中
+        registered = mLandCache.contains(rootId);
+    }
 
-    for (auto const& id : *landsIds) {
-        if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
-            if (auto const& land = iter->second; land->getAABB().hasPos(pos, !land->is3D())) {
-                result.insert(land);
-            }
+    auto&  cache = mFamilyIndexCache;
+    uint64 version{0}; // 先于构建读取，构建期间家族发生的变化会使本次结果不被缓存
+    if (registered) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto&                       entry = cache.entries[rootId];
+        if (entry.index) {
+            return entry.index;
         }
+        version = entry.version;
     }
 
-    if (!result.empty()) {
-        if (result.size() == 1) {
-            return *result.begin(); // 只有一个领地，即普通领地
-        }
+    // 构建期间不持有缓存锁，getFamilyTree 内部需要获取领地读锁
+    std::vector<LandFamilyIndex::Item> items;
+    for (auto& member : root->getFamilyTree()) {
+        items.emplace_back(member->getAABB(), member);
+    }
+    auto index = std::make_shared<LandFamilyIndex const>(std::move(items));
+    if (!registered) {
+        return index; // 未注册(或已移除)的领地不缓存，避免留下无法失效的条目
+    }
 
-        // 子领地优先级最高
-        SharedLand deepestLand = nullptr;
-        int        maxLevel    = -1;
-        for (auto& land : result) {
-            int currentLevel = land->getNestedLevel();
-            if (currentLevel > maxLevel) {
-                maxLevel    = currentLevel;
-                deepestLand = land;
-            }
-        }
-        return deepestLand;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (auto iter = cache.entries.find(rootId); iter != cache.entries.end() && iter->second.version == version) {
+        iter->second.index = index;
     }
+    return index;
+}
 
-    return nullptr;
+SharedLand LandRegistry::getLandAt(BlockPos const& pos, LandDimid dimid) const {
+    LD_TRACE_SPAN("LandRegistry::getLandAt(pos)");
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land_query::landAt(mDimensionChunkMap, mLandCache, pos, dimid);
 }
 std::unordered_set<SharedLand> LandRegistry::getLandAt(BlockPos const& center, int radius, LandDimid dimid) const {
+    LD_TRACE_SPAN("LandRegistry::getLandAt(radius)");
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land_query::landsInRadius(mDimensionChunkMap, mLandCache, center, radius, dimid);
+}
+std::unordered_set<SharedLand>
+LandRegistry::getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const {
+    LD_TRACE_SPAN("LandRegistry::getLandAt(range)");
     std::shared_lock<std::shared_mutex> lock(mMutex);
+    return land_query::landsInRange(mDimensionChunkMap, mLandCache, pos1, pos2, dimid);
+}
 
-    if (!mDimensionChunkMap.hasDimension(dimid)) {
-        return {};
-    }
+std::vector<MemoryUsage> LandRegistry::estimateMemory() const {
+    using mem_utils::heapBytes;
+    std::vector<MemoryUsage> result;
 
-    std::unordered_set<ChunkID>    visitedChunks; // 记录已访问的区块
-    std::unordered_set<SharedLand> lands;
+    {
+        std::shared_lock<std::shared_mutex> lock(mMutex);
 
-    int minChunkX = (center.x - radius) >> 4;
-    int minChunkZ = (center.z - radius) >> 4;
-    int maxChunkX = (center.x + radius) >> 4;
-    int maxChunkZ = (center.z + radius) >> 4;
+        // std::make_shared 的控制块与 Land 在同一次分配中
+        constexpr size_t landBlockSize = sizeof(Land) + 2 * sizeof(void*);
 
-    for (int x = minChunkX; x <= maxChunkX; ++x) {
-        for (int z = minChunkZ; z <= maxChunkZ; ++z) {
-            ChunkID chunkId = EncodeChunkID(x, z);
-            if (visitedChunks.find(chunkId) != visitedChunks.end()) {
-                continue; // 如果区块已经访问过，则跳过
-            }
-            visitedChunks.insert(chunkId);
+        MemoryUsage cache{"LandRegistry::mLandCache", mLandCache.size()};
+        cache.bytes = heapBytes(mLandCache) + mLandCache.size() * landBlockSize;
 
-            auto landsIds = mDimensionChunkMap.queryLand(dimid, chunkId);
-            if (!landsIds) {
-                continue;
+        // 主人、名称、描述由 StringPool 统计，此处只计成员与子领地列表
+        // 数量为名称、描述与成员在内存中的领地(懒加载换出的领地只保留成员哈希)
+        MemoryUsage context{"LandContext (members & vectors)", 0};
+        for (auto const& land : mLandCache | std::views::values) {
+            if (!land->mParsed.load(std::memory_order_acquire)) {
+                continue; // 尚未从启动快照解析
             }
+            context.count += land->mResident;
+            context.bytes += heapBytes(land->mContext.mLandMembers) + heapBytes(land->mContext.mSubLandIDs)
+                           + heapBytes(land->mEvictedMemberHashes);
+        }
 
-            for (auto const& id : *landsIds) {
-                if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
-                    if (auto const& land = iter->second; land->isCollision(center, radius)) {
-                        lands.insert(land);
-                    }
-                }
-            }
+        MemoryUsage settings{"LandRegistry::mPlayerSettings", mPlayerSettings.size()};
+        settings.bytes = heapBytes(mPlayerSettings);
+        for (auto const& [uuid, setting] : mPlayerSettings) {
+            settings.bytes += heapBytes(setting.localeCode);
         }
-    }
-    return lands;
-}
-std::unordered_set<SharedLand>
-LandRegistry::getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
 
-    if (!mDimensionChunkMap.hasDimension(dimid)) {
-        return {};
+        result.push_back(std::move(cache));
+        result.push_back(std::move(context));
+        result.push_back(std::move(settings));
+        result.push_back({"LandRegistry::mLandOperators", mLandOperators.size(), heapBytes(mLandOperators)});
+        result.push_back(mDimensionChunkMap.estimateMemory());
     }
 
-    std::unordered_set<ChunkID>    visitedChunks;
-    std::unordered_set<SharedLand> lands;
-
-    int minChunkX = std::min(pos1.x, pos2.x) >> 4;
-    int minChunkZ = std::min(pos1.z, pos2.z) >> 4;
-    int maxChunkX = std::max(pos1.x, pos2.x) >> 4;
-    int maxChunkZ = std::max(pos1.z, pos2.z) >> 4;
-
-    for (int x = minChunkX; x <= maxChunkX; ++x) {
-        for (int z = minChunkZ; z <= maxChunkZ; ++z) {
-            ChunkID chunkId = EncodeChunkID(x, z);
-            if (visitedChunks.find(chunkId) != visitedChunks.end()) {
-                continue;
-            }
-            visitedChunks.insert(chunkId);
+    result.push_back(StringPool::getInstance().estimateMemory());
 
-            auto landsIds = mDimensionChunkMap.queryLand(dimid, chunkId);
-            if (!landsIds) {
-                continue;
-            }
+    {
+        std::lock_guard<std::mutex> lock(mFamilyIndexCache.mutex);
 
-            for (auto const& id : *landsIds) {
-                if (auto iter = mLandCache.find(id); iter != mLandCache.end()) {
-                    if (auto const& land = iter->second; land->isCollision(pos1, pos2)) {
-                        lands.insert(land);
-                    }
-                }
-            }
+        MemoryUsage family{"LandRegistry::mFamilyIndexCache", mFamilyIndexCache.entries.size()};
+        family.bytes = heapBytes(mFamilyIndexCache.entries);
+        for (auto const& entry : mFamilyIndexCache.entries | std::views::values) {
+            if (!entry.index) continue;
+            family.bytes += sizeof(LandFamilyIndex) + 2 * sizeof(void*) + entry.index->heapBytes();
         }
+        result.push_back(std::move(family));
     }
-    return lands;
+    return result;
 }
 
 
@@ -813,25 +1429,6 @@ LandRegistry::getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid di
 
 
 namespace land {
-ChunkID LandRegistry::EncodeChunkID(int x, int z) {
-    auto ux = static_cast<uint64_t>(std::abs(x));
-    auto uz = static_cast<uint64_t>(std::abs(z));
-
-    uint64_t signBits = 0;
-    if (x >= 0) signBits |= (1ULL << 63);
-    if (z >= 0) signBits |= (1ULL << 62);
-    return signBits | (ux << 31) | (uz & 0x7FFFFFFF);
-    // Memory layout:
-    // [signBits][x][z] (signBits: 2 bits, x: 31 bits, z: 31 bits)
-}
-std::pair<int, int> LandRegistry::DecodeChunkID(ChunkID id) {
-    bool xPositive = (id & (1ULL << 63)) != 0;
-    bool zPositive = (id & (1ULL << 62)) != 0;
-
-    int x = static_cast<int>((id >> 31) & 0x7FFFFFFF);
-    int z = static_cast<int>(id & 0x7FFFFFFF);
-    if (!xPositive) x = -x;
-    if (!zPositive) z = -z;
-    return {x, z};
-}
+ChunkID LandRegistry::EncodeChunkID(int x, int z) { return LandDimensionChunkMap::EncodeChunkID(x, z); }
+std::pair<int, int> LandRegistry::DecodeChunkID(ChunkID id) { return LandDimensionChunkMap::DecodeChunkID(id); }
 } // namespace land
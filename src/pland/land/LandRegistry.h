@@ -1,12 +1,20 @@
 #pragma once
 #include "LandDimensionChunkMap.h"
 #include "LandIdAllocator.h"
+#include "LandJournal.h"
 #include "StorageLayerError.h"
+#include "ll/api/coro/InterruptableSleep.h"
 #include "ll/api/data/KeyValueDB.h"
 #include "pland/Global.h"
+#include "pland/aabb/LandAABBTree.h"
+#include "pland/hooks/ChunkLoadHook.h"
 #include "pland/land/Land.h"
+#include "pland/utils/MemoryEstimate.h"
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -31,30 +39,110 @@ struct PlayerSettings {
 
 class LandTemplatePermTable;
 
+using LandFamilyIndex = LandAABBTree<WeakLand>; // 领地家族空间索引(根领地及其所有子孙领地)
+
 class LandRegistry final {
     std::unique_ptr<ll::data::KeyValueDB>     mDB;                             // 领地数据库
     std::vector<UUIDs>                        mLandOperators;                  // 领地操作员
     std::unordered_map<UUIDs, PlayerSettings> mPlayerSettings;                 // 玩家设置
     std::unordered_map<LandID, SharedLand>    mLandCache;                      // 领地缓存
     mutable std::shared_mutex                 mMutex;                          // 读写锁
-    std::thread                               mThread;                         // 线程
+    std::thread                               mThread;                         // 保存线程
+    std::thread                               mSnapshotParseThread;            // 启动快照后台解析线程
     std::atomic<bool>                         mThreadStopFlag{false};          // 线程停止标志
     std::unique_ptr<LandIdAllocator>          mLandIdAllocator{nullptr};       // 领地ID分配器
     LandDimensionChunkMap                     mDimensionChunkMap;              // 维度区块映射
     std::unique_ptr<LandTemplatePermTable>    mLandTemplatePermTable{nullptr}; // 领地模板权限表
+    std::unique_ptr<LandJournal>              mJournal{nullptr};               // 领地预写日志(未启用时为空)
+
+    struct FamilyIndexCache {
+        struct Entry {
+            std::shared_ptr<LandFamilyIndex const> index;      // 为空表示尚未构建或已失效
+            uint64                                 version{0}; // 家族版本(家族内增删领地、范围或父子关系变化时递增)
+        };
+        std::unordered_map<LandID, Entry> entries; // 根领地ID => 家族索引
+        std::mutex                        mutex;
+    };
+    mutable FamilyIndexCache mFamilyIndexCache;
+
+    // 保存快照: 在服务器线程复制脏数据，在保存线程序列化并写入数据库
+    struct SaveSnapshot {
+        struct LandEntry {
+            SharedLand  land;
+            LandContext context;
+            int         dirtyCounter{0}; // 复制时的脏计数
+        };
+        uint64                                       version{0};
+        std::optional<uint64>                        journalSeq;        // 复制前最后一条日志记录的序号
+        LandID                                       nextLandId{0};     // 领地ID分配进度
+        std::vector<UUIDs>                           operators;
+        std::unordered_map<UUIDs, PlayerSettings>    playerSettings;
+        std::optional<std::pair<LandPermTable, int>> templatePermTable; // 仅在修改时复制(权限表, 脏计数)
+        std::vector<LandEntry>                       lands;             // 仅复制脏领地
+    };
+    struct SaveState {
+        std::atomic<uint64>                version{0};        // 快照序号
+        std::mutex                         writeMutex;        // 写入数据库(与移除领地互斥)
+        uint64                             writtenVersion{0}; // 最后写入的快照序号
+        std::unordered_map<LandID, uint64> removedLands;      // 已移除的领地 => 移除时的快照序号(防止旧快照写回)
+        std::mutex                         queueMutex;
+        std::condition_variable            queueCv;
+        std::optional<SaveSnapshot>        queued;            // 待写入的快照(只保留最新的)
+    };
+    mutable SaveState mSaveState;
+
+    // 懒加载(land.lazyLoad): 在加载线程读取数据库，在服务器线程装入领地
+    struct LazyLoadState {
+        std::mutex                               mutex;
+        std::condition_variable                  cv;
+        std::vector<std::pair<LandID, uint32_t>> queue; // (领地ID, 请求时的换出轮次)
+        std::thread                              thread;
+        ChunkLoadHook::Handle                    chunkLoadHook{0};
+    };
+    mutable LazyLoadState mLazyLoad;
+
+    std::shared_ptr<std::atomic<bool>>            mAutoSaveQuit{nullptr};  // 自动保存与换出协程退出标志
+    std::shared_ptr<ll::coro::InterruptableSleep> mAutoSaveSleep{nullptr}; // 自动保存间隔
+    std::shared_ptr<ll::coro::InterruptableSleep> mEvictSleep{nullptr};    // 换出间隔(未启用懒加载时为空)
 
     friend class DataConverter;
+    friend class EconomyLedger;
+    friend class Land;
 
 private: //! private 方法非线程安全
     void _loadOperators();
     void _loadPlayerSettings();
     void _loadLands();
+    bool _loadLandsFromSnapshot();
+    void _startSnapshotParser(); // 在后台解析启动快照中尚未被访问的领地
     void _loadLandTemplatePermTable();
 
     void _connectDatabaseAndCheckVersion();
-    void _checkVersionAndTryAdaptBreakingChanges(nlohmann::json& landData);
+    static void _checkVersionAndTryAdaptBreakingChanges(nlohmann::json& landData);
 
     void _buildDimensionChunkMap();
+    void _initLandIdAllocator(LandID safeId); // 起点取 safeId 与数据库中记录的较大值
+
+    LandID _findRootLandId(Land const& land) const;                              // 沿父领地查找根领地(需持有 mMutex)
+    void   _invalidateFamilyIndex(LandID rootId, bool rootRemoved = false) const; // 使家族索引失效
+
+    SaveSnapshot _takeSaveSnapshot() const;                        // 复制脏数据(服务器线程)
+    bool         _writeSaveSnapshot(SaveSnapshot const& snapshot); // 序列化并写入数据库(不持有读写锁)
+
+    bool _replayJournal(); // 返回是否重放了记录
+    void _journalUpsert(Land const& land);
+    void _journalRemove(LandID id);
+
+    // 将字段记录应用到领地(重放)，payload 无效或类型未知时返回 false
+    static bool _applyJournalRecord(Land& land, LandJournal::Record const& record);
+
+    // 由 Land 在修改后调用(加锁)，Upsert 记录由此序列化整个领地
+    void _onLandModified(Land const& land, LandJournalRecord record, std::string payload);
+
+    std::optional<LandContext> _readLandContext(LandID id) const;                        // 从数据库读取领地(任意线程)
+    void                       _requestLandDetail(LandID id, uint32_t generation) const; // 交给加载线程异步读取
+    void                       _startLazyLoader();                                       // 启动加载线程与换出协程
+    void                       _evictIdleLands();                                        // 换出闲置领地(服务器线程)
 
     LandID getNextLandID() const;
 
@@ -67,9 +155,19 @@ class LandRegistry final {
     explicit LandRegistry();
     ~LandRegistry();
 
+    /**
+     * @brief 立即保存(在当前线程复制并写入)
+     * @note 应在服务器线程调用；自动保存只在服务器线程复制脏数据，写入在保存线程完成
+     */
     LDAPI void save();
     LDAPI bool save(Land const& land) const;
 
+    /**
+     * @brief 写出启动快照(正常关服时在 save 之后调用)
+     * @note 存在未保存的领地时不写出
+     */
+    LDAPI void writeStartupSnapshot() const;
+
 public:
     LDNDAPI bool isOperator(UUIDs const& uuid) const;
 
@@ -140,22 +238,45 @@ class LandRegistry final {
 
     LDNDAPI LandPermType getPermType(UUIDs const& uuid, LandID id = 0, bool ignoreOperator = false) const;
 
+    /**
+     * @brief 获取领地家族的空间索引
+     * @param root 根领地
+     * @note 索引按需构建并按根领地缓存，仅在该家族的结构(增删领地、范围、父子关系)变化后失效
+     */
+    LDNDAPI std::shared_ptr<LandFamilyIndex const> getFamilyIndex(SharedLand const& root) const;
+
     LDNDAPI SharedLand getLandAt(BlockPos const& pos, LandDimid dimid) const;
 
     LDNDAPI std::unordered_set<SharedLand> getLandAt(BlockPos const& center, int radius, LandDimid dimid) const;
 
     LDNDAPI std::unordered_set<SharedLand> getLandAt(BlockPos const& pos1, BlockPos const& pos2, LandDimid dimid) const;
 
+    /**
+     * @brief 预取区块(及周围 radius 个区块)内的领地
+     * @note 仅在启用懒加载时生效: 被换出的领地交给加载线程异步加载，已在内存中的领地刷新访问时间
+     */
+    LDAPI void prefetchLands(LandDimid dimid, int chunkX, int chunkZ, int radius = 0) const;
+
+    /**
+     * @brief 估算领地缓存、领地上下文、玩家设置、操作员、区块映射与家族索引的内存占用
+     */
+    LDNDAPI std::vector<MemoryUsage> estimateMemory() const;
+
 public:
     LDAPI static ChunkID             EncodeChunkID(int x, int z);
     LDAPI static std::pair<int, int> DecodeChunkID(ChunkID id);
 
-    static constexpr auto DbDirName              = "db";              // 数据库目录名
-    static constexpr auto DbVersionKey           = "__version__";     // 数据库版本键
-    static constexpr auto DbOperatorDataKey      = "operators";       // 操作员数据键
-    static constexpr auto DbPlayerSettingDataKey = "player_settings"; // 玩家设置数据键
-    static constexpr auto DbTemplatePermKey      = "template_perm";   // 领地模板权限表数据键
-    static bool           isLandData(std::string_view key);           // 判断键是否为领地数据键
+    static constexpr auto DbDirName                = "db";               // 数据库目录名
+    static constexpr auto DbVersionKey             = "__version__";      // 数据库版本键
+    static constexpr auto DbOperatorDataKey        = "operators";        // 操作员数据键
+    static constexpr auto DbPlayerSettingDataKey   = "player_settings";  // 玩家设置数据键
+    static constexpr auto DbTemplatePermKey        = "template_perm";    // 领地模板权限表数据键
+    static constexpr auto DbEconomyLedgerKeyPrefix = "ledger:";          // 离线经济账本键前缀(ledger:<uuid>)
+    static constexpr auto JournalFileName          = "land.journal";     // 领地预写日志文件名
+    static constexpr auto DbSnapshotTokenKey       = "__snapshot__";     // 启动快照令牌键
+    static constexpr auto DbNextLandIdKey          = "__next_land_id__"; // 下一个领地ID(已删除的领地ID不会被复用)
+    static constexpr auto SnapshotFileName         = "land.snapshot";    // 启动快照文件名
+    static bool           isLandData(std::string_view key);              // 判断键是否为领地数据键
 };
 
 
@@ -15,6 +15,7 @@
 #include "pland/Global.h"
 #include "pland/PLand.h"
 #include "pland/infra/Config.h"
+#include "pland/infra/SpanTracer.h"
 #include "pland/land/LandEvent.h"
 #include "pland/land/LandRegistry.h"
 #include <cstdio>
@@ -155,6 +156,7 @@ LandScheduler::~LandScheduler() {
 }
 
 void LandScheduler::tickEvent() {
+    LD_TRACE_SPAN("LandScheduler::tickEvent");
     auto& bus      = ll::event::EventBus::getInstance();
     auto  registry = PLand::getInstance().getLandRegistry();
 
@@ -169,6 +171,10 @@ void LandScheduler::tickEvent() {
             int&  lastDimId  = this->mDimensionMap[player];
             auto& lastLandID = this->mLandIdMap[player];
 
+            // 懒加载: 预取玩家周围区块内的领地，走进领地前数据已在内存中
+            ChunkPos const chunk{currentPos};
+            registry->prefetchLands(currentDimId, chunk.x, chunk.z, 1);
+
             auto   land          = registry->getLandAt(currentPos, currentDimId);
             LandID currentLandId = land ? land->getId() : -1;
 
@@ -198,6 +204,7 @@ void LandScheduler::tickEvent() {
 }
 
 void LandScheduler::tickLandTip() {
+    LD_TRACE_SPAN("LandScheduler::tickLandTip");
     auto& playerInfo = ll::service::PlayerInfo::getInstance();
     auto  registry   = PLand::getInstance().getLandRegistry();
 
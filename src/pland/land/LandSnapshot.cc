@@ -0,0 +1,133 @@
+#include "pland/land/LandSnapshot.h"
+#include "pland/land/LandContext.h"
+#include "pland/land/LandDimensionChunkMap.h"
+#include "pland/utils/Crc32.h"
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+
+
+namespace land {
+
+
+static_assert(std::is_trivially_copyable_v<LandSnapshot::Header> && sizeof(LandSnapshot::Header) == 56);
+static_assert(std::is_trivially_copyable_v<LandSnapshot::LandEntry> && sizeof(LandSnapshot::LandEntry) == 24);
+static_assert(std::is_trivially_copyable_v<LandSnapshot::ChunkEntry> && sizeof(LandSnapshot::ChunkEntry) == 24);
+
+
+bool LandSnapshot::write(std::filesystem::path const& file, uint64_t token, std::vector<Source> const& lands) {
+    std::vector<ChunkEntry> chunks;
+    size_t                  payloadBytes = 0;
+    for (auto const& land : lands) {
+        payloadBytes += land.payload.size();
+        for (auto const& pos : land.aabb.getChunks()) {
+            chunks.push_back(
+                ChunkEntry{land.dimid, 0, LandDimensionChunkMap::EncodeChunkID(pos.x, pos.z), land.id}
+            );
+        }
+    }
+
+    auto const tableBytes = lands.size() * sizeof(LandEntry) + chunks.size() * sizeof(ChunkEntry);
+
+    std::string body;
+    body.resize(tableBytes);
+    body.reserve(tableBytes + payloadBytes);
+
+    auto entries = reinterpret_cast<LandEntry*>(body.data());
+    for (size_t i = 0; i < lands.size(); ++i) {
+        auto const& land = lands[i];
+        entries[i]       = LandEntry{land.id, land.dimid, static_cast<uint32_t>(land.payload.size()), body.size()};
+        body            += land.payload;
+    }
+    if (!chunks.empty()) {
+        std::memcpy(body.data() + lands.size() * sizeof(LandEntry), chunks.data(), chunks.size() * sizeof(ChunkEntry));
+    }
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.formatVersion  = FormatVersion;
+    header.contextVersion = LandContextVersion;
+    header.token          = token;
+    header.landCount      = lands.size();
+    header.chunkCount     = chunks.size();
+    header.bodySize       = body.size();
+    header.crc            = crc32::compute(body.data(), body.size());
+
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    auto tmp = std::filesystem::path{file}.concat(".tmp");
+    {
+        std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            return false;
+        }
+        ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        ofs.write(body.data(), static_cast<std::streamsize>(body.size()));
+        if (!ofs) {
+            return false;
+        }
+    }
+    std::filesystem::rename(tmp, file, ec);
+    return !ec;
+}
+
+std::optional<LandSnapshot> LandSnapshot::open(std::filesystem::path const& file, uint64_t token) {
+    LandSnapshot snapshot;
+    if (!snapshot.mFile.open(file)) {
+        return std::nullopt;
+    }
+
+    auto data = snapshot.mFile.data();
+    if (data.size() < sizeof(Header)) {
+        return std::nullopt;
+    }
+    auto header = reinterpret_cast<Header const*>(data.data());
+    if (std::memcmp(header->magic, Magic, sizeof(Magic)) != 0 || header->formatVersion != FormatVersion
+        || header->contextVersion != static_cast<uint32_t>(LandContextVersion) || header->token != token
+        || header->bodySize != data.size() - sizeof(Header)) {
+        return std::nullopt;
+    }
+
+    // 以除法与减法做边界检查，避免损坏的计数或偏移在乘法、加法中溢出后绕过检查
+    auto const bodySize = header->bodySize;
+    if (header->landCount > bodySize / sizeof(LandEntry)) {
+        return std::nullopt;
+    }
+    auto const landBytes = header->landCount * sizeof(LandEntry);
+    if (header->chunkCount > (bodySize - landBytes) / sizeof(ChunkEntry)) {
+        return std::nullopt;
+    }
+    auto const tableBytes = landBytes + header->chunkCount * sizeof(ChunkEntry);
+
+    auto body = data.data() + sizeof(Header);
+    if (crc32::compute(body, bodySize) != header->crc) {
+        return std::nullopt;
+    }
+
+    snapshot.mHeader = header;
+    snapshot.mBody   = body;
+    snapshot.mLands  = reinterpret_cast<LandEntry const*>(body);
+    snapshot.mChunks = reinterpret_cast<ChunkEntry const*>(body + landBytes);
+
+    for (size_t i = 0; i < header->landCount; ++i) {
+        auto const& entry = snapshot.mLands[i];
+        if (entry.payloadOffset < tableBytes || entry.payloadOffset > bodySize
+            || entry.payloadSize > bodySize - entry.payloadOffset) {
+            return std::nullopt;
+        }
+    }
+    return snapshot;
+}
+
+size_t LandSnapshot::landCount() const { return static_cast<size_t>(mHeader->landCount); }
+size_t LandSnapshot::chunkCount() const { return static_cast<size_t>(mHeader->chunkCount); }
+
+LandSnapshot::LandEntry const& LandSnapshot::land(size_t index) const { return mLands[index]; }
+std::string_view LandSnapshot::payload(LandEntry const& entry) const {
+    return {mBody + entry.payloadOffset, entry.payloadSize};
+}
+LandSnapshot::ChunkEntry const& LandSnapshot::chunk(size_t index) const { return mChunks[index]; }
+
+
+} // namespace land
@@ -0,0 +1,101 @@
+#pragma once
+#include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/infra/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 领地启动快照
+ * 正常关服时写出的只读镜像，包含全部领地数据与预先计算好的区块索引，
+ * 启动时以内存映射方式打开，校验通过即可跳过数据库遍历与区块映射的构建
+ *
+ * 文件内只使用相对偏移(与映射地址无关)，带有 CRC32 校验与令牌；
+ * 令牌同时写入数据库，启动时读取后立即删除，保证快照只用于紧接着的下一次启动
+ *
+ * 布局(小端): [Header][LandEntry x landCount][ChunkEntry x chunkCount][payload...]
+ */
+class LandSnapshot final {
+public:
+    static constexpr char     Magic[8]      = {'P', 'L', 'D', 'S', 'N', 'A', 'P', '\0'};
+    static constexpr uint32_t FormatVersion = 1;
+
+    struct Header {
+        char     magic[8];
+        uint32_t formatVersion;
+        uint32_t contextVersion; // LandContextVersion
+        uint64_t token;          // 与数据库中的令牌一致时才有效
+        uint64_t landCount;
+        uint64_t chunkCount;
+        uint64_t bodySize; // Header 之后的字节数
+        uint32_t crc;      // body 的 CRC32
+        uint32_t reserved;
+    };
+
+    struct LandEntry {
+        int64_t  id;
+        int32_t  dimid;
+        uint32_t payloadSize;
+        uint64_t payloadOffset; // 相对 body 起始位置
+    };
+
+    struct ChunkEntry {
+        int32_t  dimid;
+        uint32_t reserved;
+        uint64_t chunkId;
+        int64_t  landId;
+    };
+
+    /**
+     * @brief 写入快照用的领地数据
+     */
+    struct Source {
+        LandID      id;
+        LandDimid   dimid;
+        LandAABB    aabb;
+        std::string payload; // 领地 JSON
+    };
+
+    LD_DISALLOW_COPY(LandSnapshot);
+    LandSnapshot(LandSnapshot&&) noexcept            = default;
+    LandSnapshot& operator=(LandSnapshot&&) noexcept = default;
+
+    /**
+     * @brief 写出快照(先写临时文件再替换)
+     */
+    LDNDAPI static bool write(std::filesystem::path const& file, uint64_t token, std::vector<Source> const& lands);
+
+    /**
+     * @brief 映射并校验快照
+     * @return 文件不存在、令牌或版本不匹配、校验失败时返回 std::nullopt
+     */
+    LDNDAPI static std::optional<LandSnapshot> open(std::filesystem::path const& file, uint64_t token);
+
+    LDNDAPI size_t landCount() const;
+    LDNDAPI size_t chunkCount() const;
+
+    LDNDAPI LandEntry const& land(size_t index) const;
+    LDNDAPI std::string_view payload(LandEntry const& entry) const;
+    LDNDAPI ChunkEntry const& chunk(size_t index) const;
+
+private:
+    LandSnapshot() = default;
+
+    MappedFile        mFile;
+    Header const*     mHeader{nullptr};
+    LandEntry const*  mLands{nullptr};
+    ChunkEntry const* mChunks{nullptr};
+    char const*       mBody{nullptr};
+};
+
+
+} // namespace land
@@ -105,6 +105,14 @@ std::optional<LandAABB> ISelector::newLandAABB() const {
     return std::nullopt;
 }
 
+void ISelector::updatePreview(Player& player) {
+    if (!mDrawedRange || !isPointABSet()) {
+        return; // 尚未确认选区，没有预览
+    }
+    auto handle  = PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(player);
+    mDrawedRange = handle->update(mDrawedRange, *newLandAABB(), mDimid, mce::Color::GREEN());
+}
+
 std::string ISelector::dumpDebugInfo() const {
     return "DimensionId: {}, PointA: {}, PointB: {}, is3D: {}"_tr(
         mDimid,
@@ -134,12 +142,14 @@ void ISelector::onPointBSet() {
 void ISelector::onPointAUpdated() {
     if (auto player = getPlayer()) {
         mc_utils::sendText(player, "已更新点 A: {}"_trf(*player, *mPointA));
+        updatePreview(*player);
     }
 }
 
 void ISelector::onPointBUpdated() {
     if (auto player = getPlayer()) {
         mc_utils::sendText(player, "已更新点 B: {}"_trf(*player, *mPointB));
+        updatePreview(*player);
     }
 }
 
@@ -181,9 +191,10 @@ void ISelector::onPointConfirmed() {
     auto handle = PLand::getInstance().getDrawHandleManager()->getOrCreateHandle(*player);
 
     if (mDrawedRange) {
-        handle->remove(mDrawedRange);
+        mDrawedRange = handle->update(mDrawedRange, *newLandAABB(), mDimid, mce::Color::GREEN());
+    } else {
+        mDrawedRange = handle->draw(*newLandAABB(), mDimid, mce::Color::GREEN());
     }
-    mDrawedRange = handle->draw(*newLandAABB(), mDimid, mce::Color::GREEN());
 }
 
 void ISelector::tick() { sendTitle(); }
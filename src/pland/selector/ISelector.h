@@ -50,6 +50,11 @@ class ISelector {
 
     LDNDAPI std::optional<LandAABB> newLandAABB() const;
 
+    /**
+     * @brief 选区已绘制时，按当前 A/B 点增量更新预览
+     */
+    LDAPI void updatePreview(Player& player);
+
     LDNDAPI std::string dumpDebugInfo() const;
 
     template <typename T>
@@ -138,4 +138,12 @@ void SelectorManager::forEach(ForEachFunc const& func) const {
     }
 }
 
+MemoryUsage SelectorManager::estimateMemory() const {
+    return MemoryUsage{
+        "SelectorManager",
+        mSelectors.size(),
+        mem_utils::heapBytes(mSelectors) + mSelectors.size() * sizeof(ISelector) + mem_utils::heapBytes(mStabilization)
+    };
+}
+
 } // namespace land
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "ll/api/coro/InterruptableSleep.h"
 #include "ll/api/event/ListenerBase.h"
 #include "pland/Global.h"
+#include "pland/utils/MemoryEstimate.h"
 #include <unordered_map>
 
 
@@ -49,6 +50,11 @@ class SelectorManager final {
 
     using ForEachFunc = std::function<bool(UUIDm const&, ISelector*)>;
     LDAPI void forEach(ForEachFunc const& func) const;
+
+    /**
+     * @brief 估算选区状态的内存占用(选区按基类大小计)
+     */
+    LDNDAPI MemoryUsage estimateMemory() const;
 };
 
 
@@ -0,0 +1,33 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace land::crc32 {
+
+inline constexpr std::array<uint32_t, 256> Table = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+/**
+ * @brief 计算 CRC32 (IEEE 802.3)
+ */
+[[nodiscard]] inline uint32_t compute(void const* data, size_t size) {
+    auto     bytes = static_cast<uint8_t const*>(data);
+    uint32_t crc   = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc = Table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+} // namespace land::crc32
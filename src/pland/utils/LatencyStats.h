@@ -0,0 +1,77 @@
+#pragma once
+#include "fmt/format.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace land {
+
+/**
+ * @brief 延迟统计
+ * 保留最近 Capacity 个样本(毫秒)，用于计算分位数
+ * @note 非线程安全
+ */
+template <size_t Capacity = 512>
+class LatencyStats {
+    std::array<double, Capacity> mSamples{};
+    size_t                       mCursor{0};
+    size_t                       mSize{0};
+    size_t                       mTotal{0}; // 累计样本数(含已被覆盖的)
+
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void record(double ms) {
+        mSamples[mCursor] = ms;
+        mCursor           = (mCursor + 1) % Capacity;
+        mSize             = std::min(mSize + 1, Capacity);
+        ++mTotal;
+    }
+
+    void record(Clock::time_point begin, Clock::time_point end = Clock::now()) {
+        record(std::chrono::duration<double, std::milli>(end - begin).count());
+    }
+
+    [[nodiscard]] size_t size() const { return mSize; }
+    [[nodiscard]] size_t total() const { return mTotal; }
+
+    /**
+     * @brief 计算分位数
+     * @param p 0.0 ~ 1.0
+     */
+    [[nodiscard]] double percentile(double p) const {
+        if (mSize == 0) {
+            return 0;
+        }
+        std::vector<double> sorted(mSamples.begin(), mSamples.begin() + static_cast<std::ptrdiff_t>(mSize));
+        std::sort(sorted.begin(), sorted.end());
+        auto index = static_cast<size_t>(std::clamp(p, 0.0, 1.0) * static_cast<double>(mSize - 1) + 0.5);
+        return sorted[index];
+    }
+
+    /**
+     * @brief 输出 p50/p90/p99/max 摘要
+     */
+    [[nodiscard]] std::string summary() const {
+        return fmt::format(
+            "n={} p50={:.1f}ms p90={:.1f}ms p99={:.1f}ms max={:.1f}ms",
+            mTotal,
+            percentile(0.5),
+            percentile(0.9),
+            percentile(0.99),
+            percentile(1.0)
+        );
+    }
+
+    void reset() {
+        mCursor = 0;
+        mSize   = 0;
+        mTotal  = 0;
+    }
+};
+
+} // namespace land
@@ -0,0 +1,109 @@
+#pragma once
+#include "fmt/format.h"
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace land {
+
+
+/**
+ * @brief 内存占用条目
+ */
+struct MemoryUsage {
+    std::string name;     // 结构名称
+    size_t      count{0}; // 元素数量
+    size_t      bytes{0}; // 估算字节数
+};
+
+
+namespace mem_utils {
+
+/**
+ * 以下按 MSVC STL 的布局估算容器的堆内存(不含容器对象自身)，结果为近似值：
+ * - 哈希容器的节点为双向链表节点(2 个指针)，每个桶保存 2 个迭代器
+ * - std::string 超过 SSO 容量时才分配堆内存
+ */
+inline constexpr size_t HashNodeOverhead   = 2 * sizeof(void*);
+inline constexpr size_t HashBucketOverhead = 2 * sizeof(void*);
+
+template <typename T>
+struct IsVector : std::false_type {};
+template <typename T, typename A>
+struct IsVector<std::vector<T, A>> : std::true_type {};
+
+template <typename T>
+struct IsPair : std::false_type {};
+template <typename A, typename B>
+struct IsPair<std::pair<A, B>> : std::true_type {};
+
+template <typename T>
+concept HashContainer = requires(T const& t) {
+    typename T::value_type;
+    { t.bucket_count() } -> std::convertible_to<size_t>;
+    { t.size() } -> std::convertible_to<size_t>;
+};
+
+template <typename T>
+[[nodiscard]] size_t heapBytes(T const& value);
+
+template <typename T>
+[[nodiscard]] size_t elementsHeapBytes(T const& container) {
+    using Value = std::remove_cvref_t<typename T::value_type>;
+    if constexpr (std::is_arithmetic_v<Value> || std::is_enum_v<Value>) {
+        return 0;
+    } else {
+        size_t bytes = 0;
+        for (auto const& element : container) {
+            bytes += heapBytes(element);
+        }
+        return bytes;
+    }
+}
+
+/**
+ * @brief 估算对象持有的堆内存(字节)
+ * 支持 std::string、std::vector、std::pair 与哈希容器(递归)，其它类型视为不持有堆内存
+ */
+template <typename T>
+[[nodiscard]] size_t heapBytes(T const& value) {
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<U, std::string>) {
+        static size_t const ssoCapacity = std::string{}.capacity();
+        return value.capacity() > ssoCapacity ? value.capacity() + 1 : 0;
+    } else if constexpr (IsVector<U>::value) {
+        return value.capacity() * sizeof(typename U::value_type) + elementsHeapBytes(value);
+    } else if constexpr (IsPair<U>::value) {
+        return heapBytes(value.first) + heapBytes(value.second);
+    } else if constexpr (HashContainer<U>) {
+        return value.bucket_count() * HashBucketOverhead
+             + value.size() * (sizeof(typename U::value_type) + HashNodeOverhead) + elementsHeapBytes(value);
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * @brief 格式化字节数，如 "12.3 MiB"
+ */
+[[nodiscard]] inline std::string formatBytes(size_t bytes) {
+    constexpr char const* units[] = {"B", "KiB", "MiB", "GiB"};
+
+    double value = static_cast<double>(bytes);
+    size_t unit  = 0;
+    while (value >= 1024.0 && unit + 1 < std::size(units)) {
+        value /= 1024.0;
+        ++unit;
+    }
+    return unit == 0 ? fmt::format("{} B", bytes) : fmt::format("{:.1f} {}", value, units[unit]);
+}
+
+} // namespace mem_utils
+
+
+} // namespace land
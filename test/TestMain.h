@@ -10,11 +10,15 @@ struct TestMain {
         _setupLandEventTest();
         _setupPaginationFormTest();
         _setupChooseLandAdvancedUtilGUITest();
+        _setupTrfBenchmarkTest();
+        _setupPriceBenchmarkTest();
     }
 
     static void _setupLandEventTest();
     static void _setupPaginationFormTest();
     static void _setupChooseLandAdvancedUtilGUITest();
+    static void _setupTrfBenchmarkTest();
+    static void _setupPriceBenchmarkTest();
 };
 
 
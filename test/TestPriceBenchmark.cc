@@ -0,0 +1,102 @@
+#include "TestMain.h"
+#include "pland/Global.h"
+#include "pland/aabb/LandAABB.h"
+#include "pland/economy/PriceCalculate.h"
+#include "pland/infra/Config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ll/api/command/Command.h>
+#include <ll/api/command/CommandHandle.h>
+#include <ll/api/command/CommandRegistrar.h>
+#include <ll/api/command/Overload.h>
+#include <mc/server/commands/CommandOutput.h>
+#include <random>
+#include <vector>
+
+namespace test {
+
+struct PriceBenchParam {
+    int count = 10000;
+};
+
+void TestMain::_setupPriceBenchmarkTest() {
+    ll::command::CommandRegistrar::getInstance()
+        .getOrCreateCommand("testl")
+        .overload<PriceBenchParam>()
+        .text("bench_price")
+        .optional("count")
+        .execute([](CommandOrigin const&, CommandOutput& output, PriceBenchParam const& param) {
+            using Clock = std::chrono::steady_clock;
+            using land::PriceCalculate;
+
+            auto const  count   = static_cast<size_t>(std::max(param.count, 1));
+            auto const& formula = land::Config::cfg.land.bought.threeDimensionl.calculate;
+
+            std::mt19937                       gen(42);
+            std::uniform_int_distribution<int> pos(-10000, 10000);
+            std::uniform_int_distribution<int> size(1, 256);
+
+            std::vector<land::LandAABB> ranges;
+            ranges.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                land::LandPos min{pos(gen), pos(gen) % 320, pos(gen)};
+                land::LandPos max{min.x + size(gen), min.y + size(gen), min.z + size(gen)};
+                ranges.push_back(land::LandAABB{min, max});
+            }
+
+            // 逐个求值(Variable 映射)
+            double sink  = 0;
+            auto   begin = Clock::now();
+            for (auto const& range : ranges) {
+                sink += PriceCalculate::eval(formula, PriceCalculate::Variable::make(range, 0));
+            }
+            auto single = Clock::now() - begin;
+
+            // 逐个求值(直接绑定)
+            begin = Clock::now();
+            for (auto const& range : ranges) {
+                sink += PriceCalculate::eval(formula, range, 0);
+            }
+            auto bound = Clock::now() - begin;
+
+            // 批量求值
+            int const dimensionId = 0;
+            begin                 = Clock::now();
+            auto batchPrices      = PriceCalculate::evalBatch(formula, ranges, {&dimensionId, 1});
+            auto batch            = Clock::now() - begin;
+
+            size_t mismatch = 0;
+            for (size_t i = 0; i < count; i++) {
+                auto expected = PriceCalculate::eval(formula, PriceCalculate::Variable::make(ranges[i], 0));
+                if (std::abs(PriceCalculate::eval(formula, ranges[i], 0) - expected) > 1e-6
+                    || std::abs(batchPrices[i] - expected) > 1e-6) {
+                    mismatch++;
+                }
+            }
+
+            auto toNs = [&](auto dur) {
+                return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(dur).count())
+                     / static_cast<double>(count);
+            };
+            auto msg = fmt::format(
+                "[bench_price] count={} formula=\"{}\" variable={:.1f}ns/op bound={:.1f}ns/op batch={:.1f}ns/op "
+                "mismatch={} (sink={})",
+                count,
+                formula,
+                toNs(single),
+                toNs(bound),
+                toNs(batch),
+                mismatch,
+                sink
+            );
+            if (mismatch != 0) {
+                output.error(msg);
+                return;
+            }
+            output.success(msg);
+        });
+}
+
+
+} // namespace test
@@ -0,0 +1,75 @@
+#include "TestMain.h"
+#include "mc/world/actor/player/Player.h"
+#include "pland/Global.h"
+#include <algorithm>
+#include <chrono>
+#include <ll/api/command/Command.h>
+#include <ll/api/command/CommandHandle.h>
+#include <ll/api/command/CommandRegistrar.h>
+#include <ll/api/command/Overload.h>
+#include <ll/api/i18n/I18n.h>
+#include <mc/server/commands/CommandOutput.h>
+
+namespace test {
+
+struct TrfBenchParam {
+    int iterations = 100000;
+};
+
+void TestMain::_setupTrfBenchmarkTest() {
+    ll::command::CommandRegistrar::getInstance()
+        .getOrCreateCommand("testl")
+        .overload<TrfBenchParam>()
+        .text("bench_trf")
+        .optional("iterations")
+        .execute([](CommandOrigin const& origin, CommandOutput& output, TrfBenchParam const& param) {
+            using namespace ll::i18n_literals;
+            using Clock = std::chrono::steady_clock;
+
+            if (origin.getOriginType() != CommandOriginType::Player) {
+                output.error("This command can only be run by a player");
+                return;
+            }
+            auto& player = *static_cast<Player*>(origin.getEntity());
+
+            static constexpr std::string_view fmtStr = "当前使用语言包: {}";
+            auto const                        locale = land::GetPlayerLocaleCodeFromSettings(player);
+
+            // 旧路径: 每次调用按字符串键查询 i18n
+            std::size_t sink  = 0;
+            auto        begin = Clock::now();
+            for (int i = 0; i < param.iterations; i++) {
+                auto str = fmt::vformat(
+                    ll::i18n::getInstance().get(fmtStr, land::GetPlayerLocaleCodeFromSettings(player)),
+                    fmt::make_format_args(locale)
+                );
+                sink += str.size();
+            }
+            auto legacy = Clock::now() - begin;
+
+            // 新路径: 槽位索引预解析表
+            begin = Clock::now();
+            for (int i = 0; i < param.iterations; i++) {
+                auto str  = "当前使用语言包: {}"_trf(player, locale);
+                sink     += str.size();
+            }
+            auto table = Clock::now() - begin;
+
+            auto toNs = [&](auto dur) {
+                return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(dur).count())
+                     / std::max(param.iterations, 1);
+            };
+            output.success(fmt::format(
+                "[bench_trf] iterations={} locale={} legacy={:.1f}ns/op table={:.1f}ns/op literals={} (sink={})",
+                param.iterations,
+                locale,
+                toNs(legacy),
+                toNs(table),
+                land::TrfTranslationTable::getInstance().getLiteralCount(),
+                sink
+            ));
+        });
+}
+
+
+} // namespace test
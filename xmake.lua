@@ -35,6 +35,11 @@ option("devtool") -- 开发工具
     set_showmenu(true)
 option_end()
 
+option("spantrace") -- 性能追踪插桩(/pland trace)
+    set_default(false)
+    set_showmenu(true)
+option_end()
+
 rule("gen_version")
     before_build(function(target)
         import("scripts.gen_version")()
@@ -85,6 +90,10 @@ target("PLand") -- Change this to your mod name.
         add_includedirs("test")
     end
 
+    if has_config("spantrace") then
+        add_defines("LD_SPAN_TRACE")
+    end
+
     if has_config("devtool") then
         add_packages(
             "imgui",